@@ -0,0 +1,515 @@
+// Copyright Null Lantern.
+
+#include "AI/AIDecisionTrace.h"
+#include "AI/WendigoCharacter.h"
+#include "AI/SuspicionComponent.h"
+#include "AI/MonsterAITypes.h"
+#include "AIController.h"
+#include "Navigation/PathFollowingComponent.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/Archive.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Core/SereneLogChannels.h"
+
+namespace
+{
+	/** 'SAIT' */
+	constexpr uint32 TraceMagic = 0x54494153;
+	constexpr uint32 TraceVersion = 2;
+
+	TAutoConsoleVariable<int32> CVarAITrace(
+		TEXT("Serene.AI.Trace"),
+		1,
+		TEXT("Record Wendigo decisions into the AI decision trace ring buffer."),
+		ECVF_Default);
+
+	TAutoConsoleVariable<int32> CVarAITraceCapacity(
+		TEXT("Serene.AI.Trace.Capacity"),
+		32768,
+		TEXT("AI decision trace ring buffer size in records (read when a world starts)."),
+		ECVF_Default);
+
+	TAutoConsoleVariable<float> CVarAITraceHitchMs(
+		TEXT("Serene.AI.Trace.HitchMs"),
+		100.0f,
+		TEXT("Dump the AI decision trace after a frame longer than this many ms (0 = off)."),
+		ECVF_Default);
+
+	TAutoConsoleVariable<int32> CVarAITracePostHitchFrames(
+		TEXT("Serene.AI.Trace.PostHitchFrames"),
+		30,
+		TEXT("Frames recorded after a hitch before the trace is dumped."),
+		ECVF_Default);
+
+	/** Minimum real seconds between hitch dumps (a bad area should not fill the disk). */
+	constexpr double HitchDumpCooldown = 30.0;
+
+	/** Suspicion mismatch tolerated during replay (float accumulation order). */
+	constexpr float ReplaySuspicionTolerance = 1.0e-4f;
+
+	/** Divergences logged individually during replay; the rest are only counted. */
+	constexpr int32 MaxLoggedDivergences = 10;
+
+	/** Recorded frames listed in the replay report. */
+	constexpr int32 NumWorstFramesReported = 5;
+
+	FString GetTraceDir()
+	{
+		return FPaths::ProjectSavedDir() / TEXT("AITrace");
+	}
+
+	FAutoConsoleCommandWithWorld TraceDumpCommand(
+		TEXT("Serene.AI.TraceDump"),
+		TEXT("Write the AI decision trace ring buffer to Saved/AITrace/."),
+		FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+		{
+			if (UAIDecisionTraceSubsystem* Trace = World ? World->GetSubsystem<UAIDecisionTraceSubsystem>() : nullptr)
+			{
+				Trace->Dump(TEXT("Manual"));
+			}
+		}));
+
+	FAutoConsoleCommand TraceReplayCommand(
+		TEXT("Serene.AI.TraceReplay"),
+		TEXT("Replay an AI decision trace: Serene.AI.TraceReplay <File> [FirstFrame] [LastFrame]"),
+		FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+		{
+			if (Args.Num() == 0)
+			{
+				UE_LOG(LogSerene, Display, TEXT("Usage: Serene.AI.TraceReplay <File> [FirstFrame] [LastFrame]"));
+				return;
+			}
+
+			// Bare file names resolve against Saved/AITrace.
+			const FString Path = FPaths::FileExists(Args[0]) ? Args[0] : GetTraceDir() / Args[0];
+			const uint32 FirstFrame = Args.Num() > 1 ? static_cast<uint32>(FCString::Atoi64(*Args[1])) : 0;
+			const uint32 LastFrame = Args.Num() > 2 ? static_cast<uint32>(FCString::Atoi64(*Args[2])) : MAX_uint32;
+			UAIDecisionTraceSubsystem::Replay(Path, FirstFrame, LastFrame);
+		}));
+}
+
+// ---------------------------------------------------------------------------
+// Tuning
+// ---------------------------------------------------------------------------
+
+void FAIDecisionTraceTuning::CaptureFrom(const USuspicionComponent& Suspicion)
+{
+	VisibilityThreshold = Suspicion.VisibilityThreshold;
+	BaseSuspicionRate = Suspicion.BaseSuspicionRate;
+	SuspicionDecayRate = Suspicion.SuspicionDecayRate;
+	SuspiciousThreshold = Suspicion.SuspiciousThreshold;
+	AlertThreshold = Suspicion.AlertThreshold;
+	HearingSuspicionBump = Suspicion.HearingSuspicionBump;
+}
+
+void FAIDecisionTraceTuning::ApplyTo(USuspicionComponent& Suspicion) const
+{
+	Suspicion.VisibilityThreshold = VisibilityThreshold;
+	Suspicion.BaseSuspicionRate = BaseSuspicionRate;
+	Suspicion.SuspicionDecayRate = SuspicionDecayRate;
+	Suspicion.SuspiciousThreshold = SuspiciousThreshold;
+	Suspicion.AlertThreshold = AlertThreshold;
+	Suspicion.HearingSuspicionBump = HearingSuspicionBump;
+}
+
+FArchive& operator<<(FArchive& Ar, FAIDecisionTraceTuning& Tuning)
+{
+	Ar << Tuning.VisibilityThreshold << Tuning.BaseSuspicionRate << Tuning.SuspicionDecayRate
+		<< Tuning.SuspiciousThreshold << Tuning.AlertThreshold << Tuning.HearingSuspicionBump;
+	return Ar;
+}
+
+// ---------------------------------------------------------------------------
+// Subsystem
+// ---------------------------------------------------------------------------
+
+bool UAIDecisionTraceSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+#if SERENE_AI_TRACE
+	return Super::ShouldCreateSubsystem(Outer);
+#else
+	return false;
+#endif
+}
+
+bool UAIDecisionTraceSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId UAIDecisionTraceSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UAIDecisionTraceSubsystem, STATGROUP_Tickables);
+}
+
+void UAIDecisionTraceSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	// All trace memory is allocated here; recording never allocates per record.
+	Records.SetNumZeroed(FMath::Max(1024, CVarAITraceCapacity.GetValueOnGameThread()));
+	Head = 0;
+	NumValid = 0;
+
+	TaskNames.Reset();
+	TaskNames.Add(TEXT("None"));
+}
+
+void UAIDecisionTraceSubsystem::Deinitialize()
+{
+	Records.Empty();
+	Controllers.Empty();
+
+	Super::Deinitialize();
+}
+
+void UAIDecisionTraceSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	// Real time, not DeltaTime: fixed-timestep runs (soak) still hitch in wall-clock terms.
+	const double Now = FPlatformTime::Seconds();
+	LastFrameMs = LastTickRealTime > 0.0 ? static_cast<float>((Now - LastTickRealTime) * 1000.0) : 0.0f;
+	LastTickRealTime = Now;
+
+	if (HitchDumpCountdown >= 0)
+	{
+		if (HitchDumpCountdown-- == 0)
+		{
+			Dump(*FString::Printf(TEXT("Hitch%.0fms"), PendingHitchMs));
+			HitchDumpCountdown = -1;
+		}
+		return;
+	}
+
+	const float HitchMs = CVarAITraceHitchMs.GetValueOnGameThread();
+	if (HitchMs > 0.0f && LastFrameMs > HitchMs && NumValid > 0 && Now - LastHitchDumpTime > HitchDumpCooldown)
+	{
+		PendingHitchMs = LastFrameMs;
+		LastHitchDumpTime = Now;
+		HitchDumpCountdown = FMath::Max(0, CVarAITracePostHitchFrames.GetValueOnGameThread());
+
+		UE_LOG(LogSerene, Warning, TEXT("AIDecisionTrace: %.1fms frame -- dumping trace in %d frames"),
+			LastFrameMs, HitchDumpCountdown);
+	}
+}
+
+UAIDecisionTraceSubsystem::FTracedController& UAIDecisionTraceSubsystem::FindOrAddController(const UObject* Controller)
+{
+	if (FTracedController* Existing = Controllers.Find(TObjectKey<UObject>(Controller)))
+	{
+		return *Existing;
+	}
+
+	FTracedController& Traced = Controllers.Add(TObjectKey<UObject>(Controller));
+	Traced.WendigoId = static_cast<uint16>(WendigoNames.Num());
+
+	const AAIController* AIController = Cast<AAIController>(Controller);
+	WendigoNames.Add(AIController && AIController->GetPawn() ? AIController->GetPawn()->GetName() : GetNameSafe(Controller));
+
+	// Class defaults if the pawn is not a Wendigo yet.
+	FAIDecisionTraceTuning& Tuning = WendigoTunings.AddDefaulted_GetRef();
+	const AWendigoCharacter* Wendigo = AIController ? Cast<AWendigoCharacter>(AIController->GetPawn()) : nullptr;
+	if (const USuspicionComponent* Suspicion = Wendigo ? Wendigo->GetSuspicionComponent() : nullptr)
+	{
+		Tuning.CaptureFrom(*Suspicion);
+	}
+	else
+	{
+		Tuning.CaptureFrom(*GetDefault<USuspicionComponent>());
+	}
+	return Traced;
+}
+
+// ---------------------------------------------------------------------------
+// Recording
+// ---------------------------------------------------------------------------
+
+void UAIDecisionTraceSubsystem::RecordTick(const AAIController& Controller, const AWendigoCharacter& Wendigo,
+	const AActor* Player, float VisibilityScore, float DeltaTime)
+{
+	if (CVarAITrace.GetValueOnGameThread() == 0 || Records.Num() == 0)
+	{
+		return;
+	}
+
+	FTracedController& Traced = FindOrAddController(&Controller);
+
+	FAIDecisionTraceRecord& Record = Records[Head];
+	Record = FAIDecisionTraceRecord();
+	Record.WorldTime = GetWorld()->GetTimeSeconds();
+	Record.FrameNumber = static_cast<uint32>(GFrameCounter);
+	Record.DeltaTime = DeltaTime;
+	Record.FrameMs = LastFrameMs;
+	Record.PawnLocation = FVector3f(Wendigo.GetActorLocation());
+	Record.WendigoId = Traced.WendigoId;
+	Record.ActiveTask = Traced.ActiveTask;
+	Record.BehaviorState = static_cast<uint8>(Wendigo.BehaviorState);
+
+	if (const USuspicionComponent* Suspicion = Wendigo.GetSuspicionComponent())
+	{
+		Record.Suspicion = Suspicion->GetCurrentSuspicion();
+		Record.AlertLevel = static_cast<uint8>(Suspicion->GetAlertLevel());
+	}
+
+	if (Player)
+	{
+		Record.PlayerLocation = FVector3f(Player->GetActorLocation());
+		Record.PlayerVelocity = FVector3f(Player->GetVelocity());
+	}
+
+	if (VisibilityScore >= 0.0f)
+	{
+		Record.Flags |= FAIDecisionTraceRecord::SeeingPlayer;
+		Record.VisibilityScore = VisibilityScore;
+	}
+
+	if (Traced.NumHeardNoises > 0)
+	{
+		Record.NumHeardNoises = Traced.NumHeardNoises;
+		Record.NoiseLocation = Traced.NoiseLocation;
+		Traced.NumHeardNoises = 0;
+	}
+
+	if (const UPathFollowingComponent* PathFollowing = Controller.GetPathFollowingComponent())
+	{
+		Record.MoveStatus = static_cast<uint8>(PathFollowing->GetStatus());
+		Record.MoveGoal = FVector3f(PathFollowing->GetCurrentTargetLocation());
+	}
+
+	Head = (Head + 1) % Records.Num();
+	NumValid = FMath::Min(NumValid + 1, Records.Num());
+}
+
+void UAIDecisionTraceSubsystem::NoteHeardNoise(const AAIController& Controller, const FVector& Location)
+{
+	FTracedController& Traced = FindOrAddController(&Controller);
+	Traced.NumHeardNoises = static_cast<uint8>(FMath::Min<int32>(Traced.NumHeardNoises + 1, MAX_uint8));
+	Traced.NoiseLocation = FVector3f(Location);
+}
+
+void UAIDecisionTraceSubsystem::NoteTaskEntered(const UObject* Owner, const TCHAR* TaskName)
+{
+	if (!Owner)
+	{
+		return;
+	}
+
+	// Few distinct tasks: a linear scan beats hashing and keeps indices stable.
+	int32 TaskIndex = TaskNames.IndexOfByPredicate([TaskName](const FString& Name) { return Name == TaskName; });
+	if (TaskIndex == INDEX_NONE)
+	{
+		TaskIndex = TaskNames.Num() <= MAX_uint8 ? TaskNames.Add(TaskName) : 0;
+	}
+
+	FindOrAddController(Owner).ActiveTask = static_cast<uint8>(TaskIndex);
+}
+
+// ---------------------------------------------------------------------------
+// File I/O
+// ---------------------------------------------------------------------------
+
+FString UAIDecisionTraceSubsystem::Dump(const TCHAR* Reason)
+{
+	if (NumValid == 0)
+	{
+		UE_LOG(LogSerene, Display, TEXT("AIDecisionTrace: Nothing recorded"));
+		return FString();
+	}
+
+	const FString Path = GetTraceDir() / FString::Printf(TEXT("AITrace_%s_%s.sait"),
+		*FDateTime::Now().ToString(TEXT("%Y%m%d_%H%M%S")), Reason);
+
+	TUniquePtr<FArchive> Writer(IFileManager::Get().CreateFileWriter(*Path));
+	if (!Writer)
+	{
+		UE_LOG(LogSerene, Warning, TEXT("AIDecisionTrace: Could not write %s"), *Path);
+		return FString();
+	}
+
+	uint32 Magic = TraceMagic;
+	uint32 Version = TraceVersion;
+	uint32 RecordSize = sizeof(FAIDecisionTraceRecord);
+	uint32 NumRecords = static_cast<uint32>(NumValid);
+	*Writer << Magic << Version << RecordSize << NumRecords;
+	*Writer << WendigoNames << TaskNames << WendigoTunings;
+
+	// Oldest first: [Head, End) then [0, Head) once the ring has wrapped.
+	const int32 Oldest = NumValid < Records.Num() ? 0 : Head;
+	const int32 FirstSpan = FMath::Min(NumValid, Records.Num() - Oldest);
+	Writer->Serialize(&Records[Oldest], FirstSpan * sizeof(FAIDecisionTraceRecord));
+	if (FirstSpan < NumValid)
+	{
+		Writer->Serialize(&Records[0], (NumValid - FirstSpan) * sizeof(FAIDecisionTraceRecord));
+	}
+	Writer->Close();
+
+	UE_LOG(LogSerene, Display, TEXT("AIDecisionTrace: Wrote %d records (%s) to %s"), NumValid, Reason, *Path);
+	return Path;
+}
+
+void UAIDecisionTraceSubsystem::Replay(const FString& Path, uint32 FirstFrame, uint32 LastFrame)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(SereneAITraceReplay);
+
+	TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*Path));
+	if (!Reader)
+	{
+		UE_LOG(LogSerene, Warning, TEXT("AIDecisionTrace: Could not open %s"), *Path);
+		return;
+	}
+
+	uint32 Magic = 0;
+	uint32 Version = 0;
+	uint32 RecordSize = 0;
+	uint32 NumRecords = 0;
+	*Reader << Magic << Version << RecordSize << NumRecords;
+	if (Magic != TraceMagic || Version != TraceVersion || RecordSize != sizeof(FAIDecisionTraceRecord))
+	{
+		UE_LOG(LogSerene, Warning, TEXT("AIDecisionTrace: %s is not a version %u trace from this build"), *Path, TraceVersion);
+		return;
+	}
+
+	TArray<FString> WendigoNames;
+	TArray<FString> TaskNames;
+	TArray<FAIDecisionTraceTuning> WendigoTunings;
+	*Reader << WendigoNames << TaskNames << WendigoTunings;
+
+	// The count comes from the file: check it against what is left before allocating.
+	const int64 RemainingBytes = Reader->TotalSize() - Reader->Tell();
+	if (Reader->IsError() || WendigoTunings.Num() != WendigoNames.Num() || TaskNames.Num() == 0
+		|| static_cast<int64>(NumRecords) * sizeof(FAIDecisionTraceRecord) > RemainingBytes)
+	{
+		UE_LOG(LogSerene, Warning, TEXT("AIDecisionTrace: %s is truncated or corrupt"), *Path);
+		return;
+	}
+
+	TArray<FAIDecisionTraceRecord> Records;
+	Records.SetNumUninitialized(NumRecords);
+	Reader->Serialize(Records.GetData(), static_cast<int64>(NumRecords) * sizeof(FAIDecisionTraceRecord));
+	if (Reader->IsError())
+	{
+		UE_LOG(LogSerene, Warning, TEXT("AIDecisionTrace: %s is truncated"), *Path);
+		return;
+	}
+
+	auto GetTaskName = [&TaskNames](uint8 Index) -> const FString&
+	{
+		return TaskNames.IsValidIndex(Index) ? TaskNames[Index] : TaskNames[0];
+	};
+
+	// One suspicion component per traced Wendigo, running the shipping code path with its tuning.
+	TArray<TObjectPtr<USuspicionComponent>> Suspicions;
+	Suspicions.SetNum(WendigoNames.Num());
+
+	FString Csv = TEXT("Frame,WorldTime,Wendigo,Task,BehaviorState,AlertLevel,Suspicion,ReplaySuspicion,Visibility,HeardNoises,MoveStatus,FrameMs,ReplayUs\n");
+	int32 NumReplayed = 0;
+	int32 NumDivergences = 0;
+	uint64 TotalReplayCycles = 0;
+	TArray<int32> WorstFrames;
+
+	for (int32 Index = 0; Index < Records.Num(); ++Index)
+	{
+		const FAIDecisionTraceRecord& Record = Records[Index];
+		if (Record.FrameNumber < FirstFrame || Record.FrameNumber > LastFrame || !Suspicions.IsValidIndex(Record.WendigoId))
+		{
+			continue;
+		}
+
+		TObjectPtr<USuspicionComponent>& Suspicion = Suspicions[Record.WendigoId];
+		const bool bSeed = !Suspicion;
+		if (!Suspicion)
+		{
+			Suspicion = NewObject<USuspicionComponent>(GetTransientPackage());
+			Suspicion->AddToRoot();
+			WendigoTunings[Record.WendigoId].ApplyTo(*Suspicion);
+		}
+
+		const uint32 StartCycles = FPlatformTime::Cycles();
+
+		if (bSeed)
+		{
+			// The ring may start mid-game: take the first record's result as the starting state.
+			// At full visibility the gain is exactly BaseSuspicionRate * DeltaTime.
+			if (Record.Suspicion > 0.0f && Suspicion->BaseSuspicionRate > 0.0f)
+			{
+				Suspicion->ProcessSightStimulus(1.0f, Record.Suspicion / Suspicion->BaseSuspicionRate);
+			}
+		}
+		else
+		{
+			// Same order as the game: hearing arrives between ticks, then the controller tick.
+			for (int32 Noise = 0; Noise < Record.NumHeardNoises; ++Noise)
+			{
+				Suspicion->ProcessHearingStimulus(FVector(Record.NoiseLocation));
+			}
+			if (Record.Flags & FAIDecisionTraceRecord::SeeingPlayer)
+			{
+				Suspicion->ProcessSightStimulus(Record.VisibilityScore, Record.DeltaTime);
+			}
+			else
+			{
+				Suspicion->DecaySuspicion(Record.DeltaTime);
+			}
+		}
+
+		const uint32 ReplayCycles = FPlatformTime::Cycles() - StartCycles;
+		TotalReplayCycles += ReplayCycles;
+		++NumReplayed;
+
+		// Never corrected from the recording: a divergence (including a reset the trace did
+		// not see, such as pooling) is reported and carries into the following records.
+		const float ReplaySuspicion = Suspicion->GetCurrentSuspicion();
+		const bool bDiverged = FMath::Abs(ReplaySuspicion - Record.Suspicion) > ReplaySuspicionTolerance
+			|| static_cast<uint8>(Suspicion->GetAlertLevel()) != Record.AlertLevel;
+		if (bDiverged)
+		{
+			if (NumDivergences++ < MaxLoggedDivergences)
+			{
+				UE_LOG(LogSerene, Display, TEXT("AIDecisionTrace: Divergence at frame %u [%s] in %s: recorded %.4f/%u, replayed %.4f/%u"),
+					Record.FrameNumber, *WendigoNames[Record.WendigoId], *GetTaskName(Record.ActiveTask),
+					Record.Suspicion, Record.AlertLevel,
+					ReplaySuspicion, static_cast<uint8>(Suspicion->GetAlertLevel()));
+			}
+		}
+
+		Csv += FString::Printf(TEXT("%u,%.3f,%s,%s,%u,%u,%.4f,%.4f,%.3f,%d,%u,%.2f,%.2f\n"),
+			Record.FrameNumber, Record.WorldTime, *WendigoNames[Record.WendigoId], *GetTaskName(Record.ActiveTask),
+			Record.BehaviorState, Record.AlertLevel, Record.Suspicion, ReplaySuspicion,
+			(Record.Flags & FAIDecisionTraceRecord::SeeingPlayer) ? Record.VisibilityScore : -1.0f,
+			Record.NumHeardNoises,
+			Record.MoveStatus, Record.FrameMs,
+			FPlatformTime::ToMilliseconds(ReplayCycles) * 1000.0f);
+
+		WorstFrames.Add(Index);
+	}
+
+	for (TObjectPtr<USuspicionComponent>& Suspicion : Suspicions)
+	{
+		if (Suspicion)
+		{
+			Suspicion->RemoveFromRoot();
+		}
+	}
+
+	const FString CsvPath = FPaths::ChangeExtension(Path, TEXT("csv"));
+	FFileHelper::SaveStringToFile(Csv, *CsvPath);
+
+	UE_LOG(LogSerene, Display, TEXT("AIDecisionTrace: Replayed %d/%u records from %s -- %d divergences, %.3f ms total replay, CSV %s"),
+		NumReplayed, NumRecords, *Path, NumDivergences,
+		FPlatformTime::ToMilliseconds64(TotalReplayCycles), *CsvPath);
+
+	// The frames a playtester felt, with what the AI was doing at the time.
+	WorstFrames.Sort([&Records](int32 A, int32 B) { return Records[A].FrameMs > Records[B].FrameMs; });
+	for (int32 Rank = 0; Rank < FMath::Min(NumWorstFramesReported, WorstFrames.Num()); ++Rank)
+	{
+		const FAIDecisionTraceRecord& Record = Records[WorstFrames[Rank]];
+		UE_LOG(LogSerene, Display, TEXT("  %.1f ms at frame %u: [%s] %s, state %u, alert %u, suspicion %.3f"),
+			Record.FrameMs, Record.FrameNumber, *WendigoNames[Record.WendigoId], *GetTaskName(Record.ActiveTask),
+			Record.BehaviorState, Record.AlertLevel, Record.Suspicion);
+	}
+}
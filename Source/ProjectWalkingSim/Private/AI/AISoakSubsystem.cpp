@@ -0,0 +1,752 @@
+// Copyright Null Lantern.
+
+#include "AI/AISoakSubsystem.h"
+#include "AI/WendigoCharacter.h"
+#include "AI/PatrolRouteActor.h"
+#include "AI/SuspicionComponent.h"
+#include "AI/StateTreeProfiling.h"
+#include "Hiding/HidingSpotActor.h"
+#include "Hiding/HidingComponent.h"
+#include "Interaction/HideableInterface.h"
+#include "Player/SereneCharacter.h"
+#include "NavigationSystem.h"
+#include "NavigationPath.h"
+#include "EngineUtils.h"
+#include "Kismet/GameplayStatics.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/App.h"
+#include "Misc/CommandLine.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Core/SereneLogChannels.h"
+
+namespace
+{
+	TAutoConsoleVariable<float> CVarSoakFixedHz(
+		TEXT("Serene.AI.Soak.FixedHz"),
+		30.0f,
+		TEXT("Fixed simulation rate used while an AI soak runs."),
+		ECVF_Default);
+
+	TAutoConsoleVariable<float> CVarSoakEpisodeTimeout(
+		TEXT("Serene.AI.Soak.EpisodeTimeout"),
+		300.0f,
+		TEXT("Simulated seconds before an AI soak episode is ended as a timeout."),
+		ECVF_Default);
+
+	TAutoConsoleVariable<float> CVarSoakHideChance(
+		TEXT("Serene.AI.Soak.HideChance"),
+		0.5f,
+		TEXT("Per-episode chance (0-1) that the soak bot hides when chased."),
+		ECVF_Default);
+
+	/** Distance at which the bot counts a route sample as reached. */
+	constexpr float BotAcceptanceRadius = 60.0f;
+
+	/** Search radius for a hiding spot once chased. */
+	constexpr float BotHideSearchRadius = 800.0f;
+
+	/** Seconds the bot stays hidden after the chase ends. */
+	constexpr float BotMinHideDuration = 8.0f;
+
+	/** Sample interval for route recording. */
+	constexpr float RecordInterval = 0.25f;
+
+	/** Legs in a generated random route. */
+	constexpr int32 RandomRouteLegs = 6;
+
+	UAISoakSubsystem* GetSoakSubsystem(UWorld* World)
+	{
+		return World ? World->GetSubsystem<UAISoakSubsystem>() : nullptr;
+	}
+
+	FAutoConsoleCommandWithWorldAndArgs SoakCommand(
+		TEXT("Serene.AI.Soak"),
+		TEXT("Run an AI soak: Serene.AI.Soak <Episodes> [quit]"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+		{
+			if (UAISoakSubsystem* Soak = GetSoakSubsystem(World))
+			{
+				const int32 Episodes = Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 100;
+				const bool bQuit = Args.Num() > 1 && Args[1].Equals(TEXT("quit"), ESearchCase::IgnoreCase);
+				Soak->StartSoak(Episodes, bQuit);
+			}
+		}));
+
+	FAutoConsoleCommandWithWorld SoakStopCommand(
+		TEXT("Serene.AI.Soak.Stop"),
+		TEXT("Abort the running AI soak and write results so far."),
+		FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+		{
+			if (UAISoakSubsystem* Soak = GetSoakSubsystem(World))
+			{
+				Soak->StopSoak();
+			}
+		}));
+
+	FAutoConsoleCommandWithWorldAndArgs SoakRecordCommand(
+		TEXT("Serene.AI.Soak.Record"),
+		TEXT("Record the player's path as a soak bot route: Serene.AI.Soak.Record <Name>"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+		{
+			if (UAISoakSubsystem* Soak = GetSoakSubsystem(World))
+			{
+				Soak->StartRecording(Args.Num() > 0 ? Args[0] : TEXT("Route"));
+			}
+		}));
+
+	FAutoConsoleCommandWithWorld SoakStopRecordCommand(
+		TEXT("Serene.AI.Soak.StopRecord"),
+		TEXT("Stop recording and save the soak bot route."),
+		FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+		{
+			if (UAISoakSubsystem* Soak = GetSoakSubsystem(World))
+			{
+				Soak->StopRecording();
+			}
+		}));
+
+	FString GetSoakDir()
+	{
+		return FPaths::ProjectSavedDir() / TEXT("Soak");
+	}
+
+	FString GetRoutesDir()
+	{
+		return GetSoakDir() / TEXT("Routes");
+	}
+}
+
+// ---------------------------------------------------------------------------
+// Subsystem
+// ---------------------------------------------------------------------------
+
+const TCHAR* UAISoakSubsystem::OutcomeToString(EEpisodeOutcome Outcome)
+{
+	switch (Outcome)
+	{
+	case EEpisodeOutcome::Survived: return TEXT("Survived");
+	case EEpisodeOutcome::Caught:   return TEXT("Caught");
+	case EEpisodeOutcome::Timeout:  return TEXT("Timeout");
+	}
+	return TEXT("Unknown");
+}
+
+bool UAISoakSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+#if UE_BUILD_SHIPPING
+	return false;
+#else
+	return Super::ShouldCreateSubsystem(Outer);
+#endif
+}
+
+bool UAISoakSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId UAISoakSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UAISoakSubsystem, STATGROUP_Tickables);
+}
+
+void UAISoakSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	int32 Episodes = 0;
+	if (FParse::Value(FCommandLine::Get(), TEXT("SereneSoak="), Episodes) && Episodes > 0)
+	{
+		StartSoak(Episodes, /*bQuitWhenDone=*/ true);
+	}
+}
+
+void UAISoakSubsystem::Deinitialize()
+{
+	if (bSoakRunning)
+	{
+		StopSoak();
+	}
+
+	Super::Deinitialize();
+}
+
+void UAISoakSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (bRecording)
+	{
+		RecordAccumulator += DeltaTime;
+		const ASereneCharacter* Player = Cast<ASereneCharacter>(UGameplayStatics::GetPlayerPawn(GetWorld(), 0));
+		if (Player && RecordAccumulator >= RecordInterval)
+		{
+			RecordAccumulator = 0.0f;
+
+			FBotSample Sample;
+			Sample.Location = Player->GetActorLocation();
+			Sample.bCrouch = Player->GetIsCrouching();
+			Sample.bSprint = Player->GetIsSprinting();
+			RecordingRoute.Samples.Add(Sample);
+		}
+	}
+
+	if (!bSoakRunning)
+	{
+		return;
+	}
+
+	SoakSimTime += DeltaTime;
+	++SoakFrames;
+	CurrentEpisode.Duration += DeltaTime;
+
+	TickObservation(DeltaTime);
+	if (!bSoakRunning)
+	{
+		return;
+	}
+
+	TickBot(DeltaTime);
+
+	if (bSoakRunning && CurrentEpisode.Duration >= CVarSoakEpisodeTimeout.GetValueOnGameThread())
+	{
+		EndEpisode(EEpisodeOutcome::Timeout);
+	}
+}
+
+// ---------------------------------------------------------------------------
+// Soak Lifecycle
+// ---------------------------------------------------------------------------
+
+void UAISoakSubsystem::StartSoak(int32 NumEpisodes, bool bQuitWhenDone)
+{
+	UWorld* World = GetWorld();
+	ASereneCharacter* Player = Cast<ASereneCharacter>(UGameplayStatics::GetPlayerPawn(World, 0));
+	if (bSoakRunning || NumEpisodes <= 0 || !Player)
+	{
+		UE_LOG(LogSerene, Warning, TEXT("AISoak: Cannot start (running=%d, episodes=%d, player=%s)"),
+			bSoakRunning, NumEpisodes, *GetNameSafe(Player));
+		return;
+	}
+
+	BotPawn = Player;
+	PlayerStartTransform = Player->GetActorTransform();
+	EpisodesRequested = NumEpisodes;
+	bQuitOnFinish = bQuitWhenDone;
+
+	int32 Seed = 1337;
+	FParse::Value(FCommandLine::Get(), TEXT("SereneSoakSeed="), Seed);
+	Random.Initialize(Seed);
+
+	// Active Wendigos only -- dormant pooled instances stay parked.
+	TrackedWendigos.Reset();
+	for (TActorIterator<AWendigoCharacter> It(World); It; ++It)
+	{
+		if (!It->IsDormant())
+		{
+			FTrackedWendigo& Tracked = TrackedWendigos.AddDefaulted_GetRef();
+			Tracked.Wendigo = *It;
+			Tracked.InitialTransform = It->GetActorTransform();
+			Tracked.InitialPatrolRoute = It->GetPatrolRoute();
+		}
+	}
+
+	HidingSpots.Reset();
+	for (TActorIterator<AHidingSpotActor> It(World); It; ++It)
+	{
+		HidingSpots.Add(*It);
+	}
+
+	LoadRoutes();
+	CompletedEpisodes.Reset();
+	CompletedEpisodes.Reserve(NumEpisodes);
+#if SERENE_AI_PROFILING
+	SereneAIProfiling::ResetAll();
+#endif
+
+	// Fixed timestep: the engine skips frame pacing and simulates as fast as the CPU allows.
+	bSavedUseFixedTimeStep = FApp::UseFixedTimeStep();
+	SavedFixedDeltaTime = FApp::GetFixedDeltaTime();
+	FApp::SetUseFixedTimeStep(true);
+	FApp::SetFixedDeltaTime(1.0 / FMath::Max(1.0f, CVarSoakFixedHz.GetValueOnGameThread()));
+
+	SoakStartRealTime = FPlatformTime::Seconds();
+	SoakSimTime = 0.0;
+	SoakFrames = 0;
+	bSoakRunning = true;
+
+	UE_LOG(LogSerene, Display, TEXT("AISoak: Starting %d episodes (%d Wendigos, %d hiding spots, %d recorded routes, seed %d)"),
+		NumEpisodes, TrackedWendigos.Num(), HidingSpots.Num(), Routes.Num(), Seed);
+
+	StartEpisode();
+}
+
+void UAISoakSubsystem::StopSoak()
+{
+	if (bSoakRunning)
+	{
+		FinishSoak();
+	}
+}
+
+void UAISoakSubsystem::FinishSoak()
+{
+	bSoakRunning = false;
+
+	FApp::SetUseFixedTimeStep(bSavedUseFixedTimeStep);
+	FApp::SetFixedDeltaTime(SavedFixedDeltaTime);
+
+	if (ASereneCharacter* Player = BotPawn.Get())
+	{
+		Player->StopSprint();
+		Player->StopCrouching();
+	}
+
+	WriteResults();
+
+	if (bQuitOnFinish)
+	{
+		FPlatformMisc::RequestExit(/*bForce=*/ false);
+	}
+}
+
+void UAISoakSubsystem::StartEpisode()
+{
+	ASereneCharacter* Player = BotPawn.Get();
+	if (!Player)
+	{
+		FinishSoak();
+		return;
+	}
+
+	CurrentEpisode = FEpisodeStats();
+	CurrentEpisode.Index = CompletedEpisodes.Num();
+
+	if (Routes.Num() > 0)
+	{
+		CurrentRoute = Routes[CurrentEpisode.Index % Routes.Num()];
+	}
+	else if (!BuildRandomRoute(CurrentRoute))
+	{
+		UE_LOG(LogSerene, Warning, TEXT("AISoak: No recorded routes and no NavMesh for random routes -- aborting"));
+		FinishSoak();
+		return;
+	}
+	CurrentEpisode.RouteName = CurrentRoute.Name;
+	RouteSampleIndex = 0;
+
+	if (UHidingComponent* Hiding = Player->FindComponentByClass<UHidingComponent>())
+	{
+		if (Hiding->GetHidingState() != EHidingState::Free)
+		{
+			Hiding->ExitHidingSpot();
+		}
+	}
+	Player->StopSprint();
+	Player->StopCrouching();
+
+	const FVector Start = CurrentRoute.Samples.Num() > 0 ? CurrentRoute.Samples[0].Location : PlayerStartTransform.GetLocation();
+	Player->TeleportTo(Start, PlayerStartTransform.Rotator(), /*bIsATest=*/ false, /*bNoCheck=*/ true);
+
+	ResetWendigos();
+
+	bBotWillHide = Random.FRand() < CVarSoakHideChance.GetValueOnGameThread();
+	BotHiddenTime = 0.0f;
+}
+
+void UAISoakSubsystem::EndEpisode(EEpisodeOutcome Outcome)
+{
+	CurrentEpisode.Outcome = Outcome;
+	CompletedEpisodes.Add(CurrentEpisode);
+
+	UE_LOG(LogSerene, Log, TEXT("AISoak: Episode %d/%d %s after %.1fs (detected=%d, chases=%d, escapes=%d)"),
+		CompletedEpisodes.Num(), EpisodesRequested, OutcomeToString(Outcome),
+		CurrentEpisode.Duration, CurrentEpisode.bDetected, CurrentEpisode.Chases, CurrentEpisode.Escapes);
+
+	if (CompletedEpisodes.Num() >= EpisodesRequested)
+	{
+		FinishSoak();
+		return;
+	}
+
+	StartEpisode();
+}
+
+void UAISoakSubsystem::ResetWendigos()
+{
+	for (FTrackedWendigo& Tracked : TrackedWendigos)
+	{
+		AWendigoCharacter* Wendigo = Tracked.Wendigo.Get();
+		if (!Wendigo)
+		{
+			continue;
+		}
+
+		// Dormant round-trip stops the State Tree (running ExitState, e.g. GrabAttack re-enables input)
+		// and parks it at the root, so waking starts with a clean slate.
+		Wendigo->SetDormant(true);
+		Wendigo->SetActorTransform(Tracked.InitialTransform, /*bSweep=*/ false, nullptr, ETeleportType::TeleportPhysics);
+		Wendigo->ResetAIState();
+
+		// Route as at soak start (also rewinds to the first waypoint).
+		Wendigo->SetPatrolRoute(Tracked.InitialPatrolRoute.Get());
+		Wendigo->SetDormant(false);
+
+		Tracked.LastState = EWendigoBehaviorState::Patrol;
+	}
+}
+
+// ---------------------------------------------------------------------------
+// Routes
+// ---------------------------------------------------------------------------
+
+void UAISoakSubsystem::LoadRoutes()
+{
+	Routes.Reset();
+
+	const FString MapName = UGameplayStatics::GetCurrentLevelName(this);
+	TArray<FString> Files;
+	IFileManager::Get().FindFiles(Files, *(GetRoutesDir() / (MapName + TEXT("_*.csv"))), /*Files=*/ true, /*Directories=*/ false);
+
+	for (const FString& File : Files)
+	{
+		TArray<FString> Lines;
+		if (!FFileHelper::LoadFileToStringArray(Lines, *(GetRoutesDir() / File)))
+		{
+			continue;
+		}
+
+		FBotRoute& Route = Routes.AddDefaulted_GetRef();
+		Route.Name = FPaths::GetBaseFilename(File);
+
+		// Header: X,Y,Z,Crouch,Sprint
+		for (int32 LineIndex = 1; LineIndex < Lines.Num(); ++LineIndex)
+		{
+			TArray<FString> Fields;
+			if (Lines[LineIndex].ParseIntoArray(Fields, TEXT(",")) < 5)
+			{
+				continue;
+			}
+
+			FBotSample& Sample = Route.Samples.AddDefaulted_GetRef();
+			Sample.Location = FVector(FCString::Atod(*Fields[0]), FCString::Atod(*Fields[1]), FCString::Atod(*Fields[2]));
+			Sample.bCrouch = FCString::Atoi(*Fields[3]) != 0;
+			Sample.bSprint = FCString::Atoi(*Fields[4]) != 0;
+		}
+
+		if (Route.Samples.Num() < 2)
+		{
+			Routes.Pop(EAllowShrinking::No);
+		}
+	}
+}
+
+bool UAISoakSubsystem::BuildRandomRoute(FBotRoute& OutRoute)
+{
+	UWorld* World = GetWorld();
+	UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(World);
+	APawn* Player = BotPawn.Get();
+	if (!NavSys || !Player)
+	{
+		return false;
+	}
+
+	OutRoute.Name = TEXT("Random");
+	OutRoute.Samples.Reset();
+
+	FVector From = PlayerStartTransform.GetLocation();
+	const float Radius = 3000.0f;
+	for (int32 Leg = 0; Leg < RandomRouteLegs; ++Leg)
+	{
+		FNavLocation Target;
+		if (!NavSys->GetRandomReachablePointInRadius(From, Radius, Target))
+		{
+			continue;
+		}
+
+		const UNavigationPath* Path = NavSys->FindPathToLocationSynchronously(World, From, Target.Location, Player);
+		if (!Path || !Path->IsValid())
+		{
+			continue;
+		}
+
+		// Mix of gaits so detection is exercised across visibility levels.
+		const float Gait = Random.FRand();
+		for (const FVector& Point : Path->PathPoints)
+		{
+			FBotSample& Sample = OutRoute.Samples.AddDefaulted_GetRef();
+			Sample.Location = Point;
+			Sample.bCrouch = Gait < 0.3f;
+			Sample.bSprint = Gait > 0.85f;
+		}
+		From = Target.Location;
+	}
+
+	return OutRoute.Samples.Num() >= 2;
+}
+
+void UAISoakSubsystem::StartRecording(const FString& RouteName)
+{
+	RecordingRoute = FBotRoute();
+	RecordingRoute.Name = UGameplayStatics::GetCurrentLevelName(this) + TEXT("_") + RouteName;
+	RecordAccumulator = RecordInterval;
+	bRecording = true;
+
+	UE_LOG(LogSerene, Display, TEXT("AISoak: Recording route %s"), *RecordingRoute.Name);
+}
+
+void UAISoakSubsystem::StopRecording()
+{
+	if (!bRecording)
+	{
+		return;
+	}
+	bRecording = false;
+
+	FString Csv = TEXT("X,Y,Z,Crouch,Sprint\n");
+	for (const FBotSample& Sample : RecordingRoute.Samples)
+	{
+		Csv += FString::Printf(TEXT("%.1f,%.1f,%.1f,%d,%d\n"),
+			Sample.Location.X, Sample.Location.Y, Sample.Location.Z, Sample.bCrouch, Sample.bSprint);
+	}
+
+	const FString Path = GetRoutesDir() / (RecordingRoute.Name + TEXT(".csv"));
+	FFileHelper::SaveStringToFile(Csv, *Path);
+
+	UE_LOG(LogSerene, Display, TEXT("AISoak: Saved %d samples to %s"), RecordingRoute.Samples.Num(), *Path);
+}
+
+// ---------------------------------------------------------------------------
+// Bot + Observation
+// ---------------------------------------------------------------------------
+
+AHidingSpotActor* UAISoakSubsystem::FindHidingSpotNear(const FVector& Location, float Radius) const
+{
+	AHidingSpotActor* Best = nullptr;
+	float BestDistSq = FMath::Square(Radius);
+	for (const TWeakObjectPtr<AHidingSpotActor>& WeakSpot : HidingSpots)
+	{
+		AHidingSpotActor* Spot = WeakSpot.Get();
+		if (!Spot || IHideable::Execute_IsOccupied(Spot))
+		{
+			continue;
+		}
+
+		const float DistSq = static_cast<float>(FVector::DistSquared(Location, Spot->GetActorLocation()));
+		if (DistSq < BestDistSq)
+		{
+			BestDistSq = DistSq;
+			Best = Spot;
+		}
+	}
+	return Best;
+}
+
+void UAISoakSubsystem::TickBot(float DeltaTime)
+{
+	ASereneCharacter* Player = BotPawn.Get();
+	if (!Player)
+	{
+		FinishSoak();
+		return;
+	}
+
+	bool bBeingChased = false;
+	for (const FTrackedWendigo& Tracked : TrackedWendigos)
+	{
+		bBeingChased |= Tracked.LastState == EWendigoBehaviorState::Chasing;
+	}
+
+	UHidingComponent* Hiding = Player->FindComponentByClass<UHidingComponent>();
+	const EHidingState HidingState = Hiding ? Hiding->GetHidingState() : EHidingState::Free;
+
+	// --- Hidden: wait out the chase, then resume the route ---
+	if (HidingState != EHidingState::Free)
+	{
+		if (HidingState == EHidingState::Hidden)
+		{
+			BotHiddenTime += DeltaTime;
+			if (!bBeingChased && BotHiddenTime >= BotMinHideDuration)
+			{
+				Hiding->ExitHidingSpot();
+			}
+		}
+		return;
+	}
+
+	// --- Chased: try to hide, otherwise keep running the route at a sprint ---
+	if (bBeingChased && bBotWillHide && Hiding)
+	{
+		if (AHidingSpotActor* Spot = FindHidingSpotNear(Player->GetActorLocation(), BotHideSearchRadius))
+		{
+			Hiding->EnterHidingSpot(Spot);
+			BotHiddenTime = 0.0f;
+			++CurrentEpisode.Hides;
+			return;
+		}
+	}
+
+	if (!CurrentRoute.Samples.IsValidIndex(RouteSampleIndex))
+	{
+		EndEpisode(EEpisodeOutcome::Survived);
+		return;
+	}
+
+	const FBotSample& Sample = CurrentRoute.Samples[RouteSampleIndex];
+	FVector ToTarget = Sample.Location - Player->GetActorLocation();
+	ToTarget.Z = 0.0;
+	if (ToTarget.SizeSquared() < FMath::Square(BotAcceptanceRadius))
+	{
+		++RouteSampleIndex;
+		return;
+	}
+
+	const bool bWantSprint = Sample.bSprint || bBeingChased;
+	const bool bWantCrouch = Sample.bCrouch && !bWantSprint;
+	if (bWantSprint && !Player->GetIsSprinting())
+	{
+		Player->StartSprint();
+	}
+	else if (!bWantSprint && Player->GetIsSprinting())
+	{
+		Player->StopSprint();
+	}
+
+	if (bWantCrouch && !Player->GetIsCrouching())
+	{
+		Player->StartCrouching();
+	}
+	else if (!bWantCrouch && Player->GetIsCrouching())
+	{
+		Player->StopCrouching();
+	}
+
+	Player->AddMovementInput(ToTarget.GetSafeNormal());
+}
+
+void UAISoakSubsystem::TickObservation(float DeltaTime)
+{
+	for (FTrackedWendigo& Tracked : TrackedWendigos)
+	{
+		const AWendigoCharacter* Wendigo = Tracked.Wendigo.Get();
+		if (!Wendigo)
+		{
+			continue;
+		}
+
+		if (const USuspicionComponent* Suspicion = Wendigo->GetSuspicionComponent())
+		{
+			CurrentEpisode.MaxSuspicion = FMath::Max(CurrentEpisode.MaxSuspicion, Suspicion->GetCurrentSuspicion());
+			if (!CurrentEpisode.bDetected && Suspicion->GetAlertLevel() == EAlertLevel::Alert)
+			{
+				CurrentEpisode.bDetected = true;
+				CurrentEpisode.TimeToDetect = CurrentEpisode.Duration;
+			}
+		}
+
+		const EWendigoBehaviorState State = Wendigo->BehaviorState;
+		if (State != Tracked.LastState)
+		{
+			if (State == EWendigoBehaviorState::Chasing)
+			{
+				++CurrentEpisode.Chases;
+			}
+			else if (Tracked.LastState == EWendigoBehaviorState::Chasing && State != EWendigoBehaviorState::GrabAttack)
+			{
+				++CurrentEpisode.Escapes;
+			}
+			Tracked.LastState = State;
+		}
+
+		// End before GrabAttack reaches OnPlayerDeath (Game Over UI)
+		if (State == EWendigoBehaviorState::GrabAttack)
+		{
+			EndEpisode(EEpisodeOutcome::Caught);
+			return;
+		}
+	}
+}
+
+// ---------------------------------------------------------------------------
+// Output
+// ---------------------------------------------------------------------------
+
+void UAISoakSubsystem::WriteResults() const
+{
+	const double RealSeconds = FMath::Max(UE_SMALL_NUMBER, FPlatformTime::Seconds() - SoakStartRealTime);
+	const FString Prefix = GetSoakDir() / FString::Printf(TEXT("Soak_%s_%s"),
+		*UGameplayStatics::GetCurrentLevelName(this), *FDateTime::Now().ToString(TEXT("%Y%m%d_%H%M%S")));
+
+	// --- Episodes ---
+	FString Episodes = TEXT("Episode,Route,Outcome,Duration,Detected,TimeToDetect,Chases,Escapes,Hides,MaxSuspicion\n");
+	int32 NumDetected = 0;
+	int32 NumCaught = 0;
+	int32 NumChases = 0;
+	int32 NumEscapes = 0;
+	double DetectTimeSum = 0.0;
+	for (const FEpisodeStats& Episode : CompletedEpisodes)
+	{
+		Episodes += FString::Printf(TEXT("%d,%s,%s,%.2f,%d,%.2f,%d,%d,%d,%.3f\n"),
+			Episode.Index, *Episode.RouteName, OutcomeToString(Episode.Outcome),
+			Episode.Duration, Episode.bDetected, Episode.TimeToDetect,
+			Episode.Chases, Episode.Escapes, Episode.Hides, Episode.MaxSuspicion);
+
+		NumDetected += Episode.bDetected ? 1 : 0;
+		NumCaught += Episode.Outcome == EEpisodeOutcome::Caught ? 1 : 0;
+		NumChases += Episode.Chases;
+		NumEscapes += Episode.Escapes;
+		DetectTimeSum += Episode.bDetected ? Episode.TimeToDetect : 0.0;
+	}
+	FFileHelper::SaveStringToFile(Episodes, *(Prefix + TEXT("_Episodes.csv")));
+
+	// --- Summary ---
+	const int32 NumEpisodes = FMath::Max(1, CompletedEpisodes.Num());
+	FString Summary = TEXT("Episodes,DetectionRate,AvgTimeToDetect,Chases,EscapeRate,CatchRate,SimSeconds,RealSeconds,Speedup,Frames,RealMsPerFrame\n");
+	Summary += FString::Printf(TEXT("%d,%.4f,%.2f,%d,%.4f,%.4f,%.1f,%.1f,%.1f,%lld,%.4f\n"),
+		CompletedEpisodes.Num(),
+		static_cast<double>(NumDetected) / NumEpisodes,
+		NumDetected > 0 ? DetectTimeSum / NumDetected : 0.0,
+		NumChases,
+		NumChases > 0 ? static_cast<double>(NumEscapes) / NumChases : 0.0,
+		static_cast<double>(NumCaught) / NumEpisodes,
+		SoakSimTime, RealSeconds, SoakSimTime / RealSeconds,
+		SoakFrames, SoakFrames > 0 ? RealSeconds * 1000.0 / SoakFrames : 0.0);
+	FFileHelper::SaveStringToFile(Summary, *(Prefix + TEXT("_Summary.csv")));
+
+#if SERENE_AI_PROFILING
+	// --- Per AI node CPU ---
+	FString Nodes = TEXT("Node,Phase,Calls,TotalMs,AvgUs,MaxUs,MsPerSimSecond\n");
+	SereneAIProfiling::ForEachNode([&Nodes, this](const FSereneAIProfileNode& Node)
+	{
+		for (int32 PhaseIndex = 0; PhaseIndex < static_cast<int32>(ESereneAIProfilePhase::Num); ++PhaseIndex)
+		{
+			const FSereneAIProfileNode::FPhaseSamples& Samples = Node.Phases[PhaseIndex];
+			if (Samples.TotalCount == 0)
+			{
+				continue;
+			}
+
+			const double TotalMs = FPlatformTime::ToMilliseconds64(Samples.TotalCycles);
+			Nodes += FString::Printf(TEXT("%s,%s,%llu,%.3f,%.3f,%.3f,%.5f\n"),
+				*Node.Name,
+				SereneAIProfiling::GetPhaseName(static_cast<ESereneAIProfilePhase>(PhaseIndex)),
+				Samples.TotalCount,
+				TotalMs,
+				TotalMs * 1000.0 / Samples.TotalCount,
+				FPlatformTime::ToMilliseconds(Samples.MaxCycles) * 1000.0,
+				SoakSimTime > 0.0 ? TotalMs / SoakSimTime : 0.0);
+		}
+	});
+	FFileHelper::SaveStringToFile(Nodes, *(Prefix + TEXT("_AINodes.csv")));
+#endif
+
+	UE_LOG(LogSerene, Display, TEXT("AISoak: %d episodes, detection %.1f%%, catch %.1f%%, %.0fx real time -> %s_*.csv"),
+		CompletedEpisodes.Num(),
+		100.0 * NumDetected / NumEpisodes,
+		100.0 * NumCaught / NumEpisodes,
+		SoakSimTime / RealSeconds,
+		*Prefix);
+}
@@ -1,6 +1,7 @@
 // Copyright Null Lantern.
 
 #include "AI/Conditions/STC_StimulusType.h"
+#include "AI/StateTreeProfiling.h"
 #include "AIController.h"
 #include "AI/WendigoCharacter.h"
 #include "AI/SuspicionComponent.h"
@@ -14,6 +15,8 @@ bool FSTC_StimulusType::Link(FStateTreeLinker& Linker)
 
 bool FSTC_StimulusType::TestCondition(FStateTreeExecutionContext& Context) const
 {
+	SERENE_AI_PROFILE_SCOPE(STC_StimulusType, TestCondition);
+
 	const AAIController& Controller = Context.GetExternalData(ControllerHandle);
 
 	APawn* Pawn = Controller.GetPawn();
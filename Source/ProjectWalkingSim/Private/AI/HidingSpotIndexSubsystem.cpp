@@ -0,0 +1,303 @@
+// Copyright Null Lantern.
+
+#include "AI/HidingSpotIndexSubsystem.h"
+#include "Hiding/HidingSpotActor.h"
+#include "Hiding/HidingSpotDataAsset.h"
+#include "Interaction/HideableInterface.h"
+#include "NavigationSystem.h"
+#include "Core/SereneLogChannels.h"
+
+void UHidingSpotIndexSubsystem::Deinitialize()
+{
+	Entries.Empty();
+	FreeEntries.Empty();
+	SpotToEntry.Empty();
+	Grid.Empty();
+
+	Super::Deinitialize();
+}
+
+bool UHidingSpotIndexSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+FIntPoint UHidingSpotIndexSubsystem::GetCell(const FVector& Location) const
+{
+	return FIntPoint(
+		FMath::FloorToInt32(Location.X / CellSize),
+		FMath::FloorToInt32(Location.Y / CellSize));
+}
+
+// ---------------------------------------------------------------------------
+// Registration
+// ---------------------------------------------------------------------------
+
+void UHidingSpotIndexSubsystem::RegisterSpot(AHidingSpotActor* Spot)
+{
+	if (!Spot || SpotToEntry.Contains(Spot))
+	{
+		return;
+	}
+
+	const int32 EntryIndex = FreeEntries.Num() > 0 ? FreeEntries.Pop(EAllowShrinking::No) : Entries.AddDefaulted();
+
+	FSpotEntry& Entry = Entries[EntryIndex];
+	Entry = FSpotEntry();
+	Entry.Spot = Spot;
+	Entry.Location = Spot->GetActorLocation();
+
+	if (const UHidingSpotDataAsset* SpotData = IHideable::Execute_GetSpotData(Spot))
+	{
+		Entry.SpotType = SpotData->SpotTypeTag;
+	}
+
+	SpotToEntry.Add(Spot, EntryIndex);
+	Grid.FindOrAdd(GetCell(Entry.Location)).Add(EntryIndex);
+
+	UE_LOG(LogSerene, Verbose, TEXT("HidingSpotIndex: Registered %s (%d spots)"), *Spot->GetName(), SpotToEntry.Num());
+}
+
+void UHidingSpotIndexSubsystem::UnregisterSpot(AHidingSpotActor* Spot)
+{
+	int32 EntryIndex = INDEX_NONE;
+	if (!Spot || !SpotToEntry.RemoveAndCopyValue(Spot, EntryIndex))
+	{
+		return;
+	}
+
+	FSpotEntry& Entry = Entries[EntryIndex];
+	if (TArray<int32>* Cell = Grid.Find(GetCell(Entry.Location)))
+	{
+		Cell->RemoveSingleSwap(EntryIndex, EAllowShrinking::No);
+	}
+
+	Entry = FSpotEntry();
+	FreeEntries.Add(EntryIndex);
+}
+
+void UHidingSpotIndexSubsystem::MarkChecked(const AActor* Spot)
+{
+	const UWorld* World = GetWorld();
+	if (const int32* EntryIndex = SpotToEntry.Find(Spot))
+	{
+		Entries[*EntryIndex].LastCheckedTime = World ? World->GetTimeSeconds() : 0.0;
+	}
+}
+
+// ---------------------------------------------------------------------------
+// Navigation Caches
+// ---------------------------------------------------------------------------
+
+void UHidingSpotIndexSubsystem::ResolveApproachPoint(FSpotEntry& Entry, const AActor* Querier) const
+{
+	Entry.bApproachResolved = true;
+	Entry.ApproachPoint = Entry.Location;
+
+	const AHidingSpotActor* Spot = Entry.Spot.Get();
+	UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld());
+	if (!Spot || !NavSys)
+	{
+		return;
+	}
+
+	// Spots are entered from the front; stand there rather than at the (blocked) mesh centre.
+	const FVector Front = Entry.Location + Spot->GetActorForwardVector() * ApproachDistance;
+	const ANavigationData* NavData = Querier
+		? NavSys->GetNavDataForActor(*Querier)
+		: NavSys->GetDefaultNavDataInstance(FNavigationSystem::DontCreate);
+
+	FNavLocation Projected;
+	if (NavSys->ProjectPointToNavigation(Front, Projected, FVector(ApproachDistance, ApproachDistance, 250.0f), NavData)
+		|| NavSys->ProjectPointToNavigation(Entry.Location, Projected, FVector(ApproachDistance * 2.0f, ApproachDistance * 2.0f, 250.0f), NavData))
+	{
+		Entry.ApproachPoint = Projected.Location;
+	}
+}
+
+float UHidingSpotIndexSubsystem::GetPathDistance(FSpotEntry& Entry, const FVector& Origin,
+	const AActor* Querier, double Now) const
+{
+	const FIntPoint OriginKey(
+		FMath::FloorToInt32(Origin.X / PathCacheCellSize),
+		FMath::FloorToInt32(Origin.Y / PathCacheCellSize));
+
+	if (const FCachedPathDistance* Cached = Entry.PathDistances.Find(OriginKey))
+	{
+		if (Now - Cached->Time < PathCacheLifetime)
+		{
+			return Cached->Length;
+		}
+	}
+
+	float Length = -1.0f;
+	if (UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld()))
+	{
+		const ANavigationData* NavData = Querier ? NavSys->GetNavDataForActor(*Querier) : nullptr;
+
+		FVector::FReal PathLength = 0.0;
+		if (NavSys->GetPathLength(Origin, Entry.ApproachPoint, PathLength, const_cast<ANavigationData*>(NavData))
+			== ENavigationQueryResult::Success)
+		{
+			Length = static_cast<float>(PathLength);
+		}
+	}
+	else
+	{
+		Length = static_cast<float>(FVector::Dist(Origin, Entry.ApproachPoint));
+	}
+
+	if (Entry.PathDistances.Num() >= MaxCachedPathsPerSpot)
+	{
+		Entry.PathDistances.Reset();
+	}
+	Entry.PathDistances.Add(OriginKey, { Length, Now });
+	return Length;
+}
+
+// ---------------------------------------------------------------------------
+// Query
+// ---------------------------------------------------------------------------
+
+int32 UHidingSpotIndexSubsystem::FindBestSpots(const FHidingSpotQuery& Query, TArray<FHidingSpotCandidate>& OutCandidates)
+{
+	OutCandidates.Reset();
+
+	const UWorld* World = GetWorld();
+	if (!World || Query.MaxResults <= 0 || Query.Radius <= 0.0f || SpotToEntry.Num() == 0)
+	{
+		return 0;
+	}
+
+	const double Now = World->GetTimeSeconds();
+	const float RadiusSq = FMath::Square(Query.Radius);
+
+	// Score without the path term: type weight, recency, discovered. Zero means "not worth checking now".
+	const auto BaseScore = [&Query, Now](const FSpotEntry& Entry) -> float
+	{
+		const float* TypeWeight = Query.TypeWeights ? Query.TypeWeights->Find(Entry.SpotType) : nullptr;
+		const float Recency = Query.RecheckCooldown > 0.0f
+			? FMath::Clamp(static_cast<float>((Now - Entry.LastCheckedTime) / Query.RecheckCooldown), 0.0f, 1.0f)
+			: 1.0f;
+		const float Discovered = IHideable::Execute_WasDiscovered(Entry.Spot.Get()) ? DiscoveredBonus : 1.0f;
+		return (TypeWeight ? *TypeWeight : 1.0f) * Recency * Discovered;
+	};
+
+	// --- Broad phase: grid cells overlapping the radius, bounded min-heap on score upper bound ---
+	// A path is never shorter than the straight line, so BaseScore / (1 + Dist / Radius) bounds the final score.
+	struct FPreselect
+	{
+		int32 EntryIndex;
+		float BaseScore;
+		float UpperBound;
+	};
+	const auto LowestFirst = [](const FPreselect& A, const FPreselect& B) { return A.UpperBound < B.UpperBound; };
+
+	const int32 MaxPreselect = Query.MaxResults * 2;
+	TArray<FPreselect, TInlineAllocator<16>> Preselected;
+
+	const FIntPoint MinCell = GetCell(Query.Origin - FVector(Query.Radius, Query.Radius, 0.0));
+	const FIntPoint MaxCell = GetCell(Query.Origin + FVector(Query.Radius, Query.Radius, 0.0));
+	int32 PriorityEntry = INDEX_NONE;
+
+	for (int32 CellY = MinCell.Y; CellY <= MaxCell.Y; ++CellY)
+	{
+		for (int32 CellX = MinCell.X; CellX <= MaxCell.X; ++CellX)
+		{
+			const TArray<int32>* Cell = Grid.Find(FIntPoint(CellX, CellY));
+			if (!Cell)
+			{
+				continue;
+			}
+
+			for (const int32 EntryIndex : *Cell)
+			{
+				const FSpotEntry& Entry = Entries[EntryIndex];
+				const AHidingSpotActor* Spot = Entry.Spot.Get();
+				if (!Spot)
+				{
+					continue;
+				}
+
+				const float DistSq = static_cast<float>(FVector::DistSquared(Query.Origin, Entry.Location));
+				if (DistSq > RadiusSq)
+				{
+					continue;
+				}
+
+				if (Spot == Query.PrioritySpot)
+				{
+					PriorityEntry = EntryIndex;
+					continue;
+				}
+
+				const float Base = BaseScore(Entry);
+				if (Base <= 0.0f)
+				{
+					continue;
+				}
+
+				const float UpperBound = Base / (1.0f + FMath::Sqrt(DistSq) / Query.Radius);
+				if (Preselected.Num() < MaxPreselect)
+				{
+					Preselected.HeapPush({ EntryIndex, Base, UpperBound }, LowestFirst);
+				}
+				else if (UpperBound > Preselected.HeapTop().UpperBound)
+				{
+					Preselected.HeapPopDiscard(LowestFirst, EAllowShrinking::No);
+					Preselected.HeapPush({ EntryIndex, Base, UpperBound }, LowestFirst);
+				}
+			}
+		}
+	}
+
+	// --- Narrow phase: path distance (cached) refines the score of the preselected few ---
+	const auto ScoreEntry = [this, &Query, Now](int32 EntryIndex, float Base, FHidingSpotCandidate& OutCandidate) -> bool
+	{
+		FSpotEntry& Entry = Entries[EntryIndex];
+		if (!Entry.bApproachResolved)
+		{
+			ResolveApproachPoint(Entry, Query.Querier);
+		}
+
+		const float PathDistance = GetPathDistance(Entry, Query.Origin, Query.Querier, Now);
+		if (PathDistance < 0.0f)
+		{
+			return false;
+		}
+
+		OutCandidate.Spot = Entry.Spot;
+		OutCandidate.ApproachPoint = Entry.ApproachPoint;
+		OutCandidate.PathDistance = PathDistance;
+		OutCandidate.Score = Base / (1.0f + PathDistance / Query.Radius);
+		return true;
+	};
+
+	OutCandidates.Reserve(Preselected.Num() + 1);
+	for (const FPreselect& Item : Preselected)
+	{
+		FHidingSpotCandidate Candidate;
+		if (ScoreEntry(Item.EntryIndex, Item.BaseScore, Candidate))
+		{
+			OutCandidates.Add(MoveTemp(Candidate));
+		}
+	}
+
+	OutCandidates.Sort([](const FHidingSpotCandidate& A, const FHidingSpotCandidate& B) { return A.Score > B.Score; });
+
+	if (PriorityEntry != INDEX_NONE)
+	{
+		FHidingSpotCandidate Candidate;
+		if (ScoreEntry(PriorityEntry, BaseScore(Entries[PriorityEntry]), Candidate))
+		{
+			OutCandidates.Insert(MoveTemp(Candidate), 0);
+		}
+	}
+
+	if (OutCandidates.Num() > Query.MaxResults)
+	{
+		OutCandidates.SetNum(Query.MaxResults, EAllowShrinking::No);
+	}
+
+	return OutCandidates.Num();
+}
@@ -0,0 +1,88 @@
+// Copyright Null Lantern.
+
+#include "AI/NavModifierQueueSubsystem.h"
+#include "AI/OpenableNavModifierComponent.h"
+#include "HAL/IConsoleManager.h"
+#include "Core/SereneLogChannels.h"
+
+static TAutoConsoleVariable<float> CVarNavModifierUpdatesPerSecond(
+	TEXT("Serene.Nav.ModifierUpdatesPerSecond"),
+	6.0f,
+	TEXT("Maximum door/drawer nav-area changes applied per second (each dirties the tiles under one modifier)."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarNavModifierUpdateBurst(
+	TEXT("Serene.Nav.ModifierUpdateBurst"),
+	2,
+	TEXT("Maximum nav-area changes applied in a single frame after the queue has been idle."),
+	ECVF_Default);
+
+void UNavModifierQueueSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	UpdateTokens = static_cast<float>(FMath::Max(1, CVarNavModifierUpdateBurst.GetValueOnGameThread()));
+}
+
+void UNavModifierQueueSubsystem::Deinitialize()
+{
+	PendingModifiers.Empty();
+
+	Super::Deinitialize();
+}
+
+bool UNavModifierQueueSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId UNavModifierQueueSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UNavModifierQueueSubsystem, STATGROUP_Tickables);
+}
+
+void UNavModifierQueueSubsystem::Enqueue(UOpenableNavModifierComponent* Modifier)
+{
+	if (!Modifier || Modifier->bUpdateQueued)
+	{
+		return;
+	}
+
+	Modifier->bUpdateQueued = true;
+	PendingModifiers.Add(Modifier);
+
+	UE_LOG(LogSerene, Verbose, TEXT("NavModifierQueue: Enqueued %s (pending=%d)"),
+		Modifier->GetOwner() ? *Modifier->GetOwner()->GetName() : TEXT("None"),
+		PendingModifiers.Num());
+}
+
+void UNavModifierQueueSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	const float Rate = FMath::Max(0.1f, CVarNavModifierUpdatesPerSecond.GetValueOnGameThread());
+	const float Burst = static_cast<float>(FMath::Max(1, CVarNavModifierUpdateBurst.GetValueOnGameThread()));
+	UpdateTokens = FMath::Min(UpdateTokens + Rate * DeltaTime, Burst);
+
+	int32 NumProcessed = 0;
+	while (NumProcessed < PendingModifiers.Num() && UpdateTokens >= 1.0f)
+	{
+		UOpenableNavModifierComponent* Modifier = PendingModifiers[NumProcessed++].Get();
+		if (!Modifier)
+		{
+			continue;
+		}
+
+		// Only pay for changes that actually reach the navmesh (toggled back before
+		// its turn means nothing to rebuild).
+		if (Modifier->ApplyDesiredAreaClass())
+		{
+			UpdateTokens -= 1.0f;
+		}
+	}
+
+	if (NumProcessed > 0)
+	{
+		PendingModifiers.RemoveAt(0, NumProcessed, EAllowShrinking::No);
+	}
+}
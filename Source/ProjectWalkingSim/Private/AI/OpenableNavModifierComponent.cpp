@@ -0,0 +1,67 @@
+// Copyright Null Lantern.
+
+#include "AI/OpenableNavModifierComponent.h"
+#include "AI/NavModifierQueueSubsystem.h"
+#include "NavAreas/NavArea_Default.h"
+#include "NavAreas/NavArea_Null.h"
+#include "Core/SereneLogChannels.h"
+
+UOpenableNavModifierComponent::UOpenableNavModifierComponent(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	// Closed by default: the baked navmesh treats the opening as blocked.
+	OpenAreaClass = UNavArea_Default::StaticClass();
+	ClosedAreaClass = UNavArea_Null::StaticClass();
+	AreaClass = ClosedAreaClass;
+}
+
+void UOpenableNavModifierComponent::OnRegister()
+{
+	// Sync before registering with the nav system so owners that override
+	// ClosedAreaClass in their constructor are baked with the right area.
+	AreaClass = bDesiredOpen ? OpenAreaClass : ClosedAreaClass;
+
+	Super::OnRegister();
+}
+
+void UOpenableNavModifierComponent::SetOpenState(bool bOpen)
+{
+	bDesiredOpen = bOpen;
+
+	const TSubclassOf<UNavArea> DesiredArea = bDesiredOpen ? OpenAreaClass : ClosedAreaClass;
+	if (DesiredArea == AreaClass || bUpdateQueued)
+	{
+		// Already correct, or the pending update will pick up the new desired state.
+		return;
+	}
+
+	UWorld* World = GetWorld();
+	UNavModifierQueueSubsystem* Queue = World ? World->GetSubsystem<UNavModifierQueueSubsystem>() : nullptr;
+	if (!Queue)
+	{
+		// No queue in this world type (editor preview) -- apply directly.
+		ApplyDesiredAreaClass();
+		return;
+	}
+
+	Queue->Enqueue(this);
+}
+
+bool UOpenableNavModifierComponent::ApplyDesiredAreaClass()
+{
+	bUpdateQueued = false;
+
+	const TSubclassOf<UNavArea> DesiredArea = bDesiredOpen ? OpenAreaClass : ClosedAreaClass;
+	if (DesiredArea == AreaClass)
+	{
+		return false;
+	}
+
+	// SetAreaClass refreshes only this component's bounds in the navmesh.
+	SetAreaClass(DesiredArea);
+
+	UE_LOG(LogSerene, Verbose, TEXT("OpenableNavModifier [%s]: Area -> %s"),
+		GetOwner() ? *GetOwner()->GetName() : TEXT("None"),
+		DesiredArea ? *DesiredArea->GetName() : TEXT("None"));
+	return true;
+}
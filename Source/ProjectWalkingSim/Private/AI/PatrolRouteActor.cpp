@@ -2,6 +2,10 @@
 
 #include "AI/PatrolRouteActor.h"
 #include "Components/BillboardComponent.h"
+#include "NavigationSystem.h"
+#include "NavigationPath.h"
+#include "Algo/BinarySearch.h"
+#include "Core/SereneLogChannels.h"
 #if WITH_EDITOR
 #include "DrawDebugHelpers.h"
 #endif
@@ -73,6 +77,136 @@ int32 APatrolRouteActor::GetNextWaypointIndex(int32 CurrentIndex) const
 	return NextIndex;
 }
 
+// ---------------------------------------------------------------------------
+// Patrol Graph
+// ---------------------------------------------------------------------------
+
+void FPatrolPolyline::Build(TArray<FVector>&& InPoints)
+{
+	Points = MoveTemp(InPoints);
+	CumulativeDistances.SetNumUninitialized(Points.Num());
+
+	float Total = 0.0f;
+	for (int32 i = 0; i < Points.Num(); ++i)
+	{
+		if (i > 0)
+		{
+			Total += FVector::Dist(Points[i - 1], Points[i]);
+		}
+		CumulativeDistances[i] = Total;
+	}
+}
+
+FVector FPatrolPolyline::Sample(float Distance, bool bReverse, FVector* OutDirection) const
+{
+	if (Points.Num() == 0)
+	{
+		return FVector::ZeroVector;
+	}
+	if (Points.Num() == 1)
+	{
+		if (OutDirection)
+		{
+			*OutDirection = FVector::ForwardVector;
+		}
+		return Points[0];
+	}
+
+	const float Length = GetLength();
+	const float Clamped = FMath::Clamp(Distance, 0.0f, Length);
+	const float ForwardDistance = bReverse ? (Length - Clamped) : Clamped;
+
+	// First cumulative distance strictly greater than ForwardDistance marks the segment end
+	const int32 EndIndex = FMath::Clamp(
+		Algo::UpperBound(CumulativeDistances, ForwardDistance), 1, Points.Num() - 1);
+	const int32 StartIndex = EndIndex - 1;
+
+	const float SegmentLength = CumulativeDistances[EndIndex] - CumulativeDistances[StartIndex];
+	const float Alpha = SegmentLength > KINDA_SMALL_NUMBER
+		? (ForwardDistance - CumulativeDistances[StartIndex]) / SegmentLength
+		: 1.0f;
+
+	if (OutDirection)
+	{
+		const FVector Dir = (Points[EndIndex] - Points[StartIndex]).GetSafeNormal();
+		*OutDirection = bReverse ? -Dir : Dir;
+	}
+
+	return FMath::Lerp(Points[StartIndex], Points[EndIndex], Alpha);
+}
+
+void APatrolRouteActor::BuildPatrolGraph(const AActor* NavAgent)
+{
+	if (bPatrolGraphBuilt)
+	{
+		return;
+	}
+	bPatrolGraphBuilt = true;
+
+	const int32 NumWaypoints = Waypoints.Num();
+	Legs.Reset();
+	if (NumWaypoints < 2)
+	{
+		return;
+	}
+
+	UWorld* World = GetWorld();
+	UNavigationSystemV1* NavSys = World ? FNavigationSystem::GetCurrent<UNavigationSystemV1>(World) : nullptr;
+
+	Legs.SetNum(NumWaypoints);
+	for (int32 i = 0; i < NumWaypoints; ++i)
+	{
+		const FVector Start = GetWaypoint(i);
+		const FVector End = GetWaypoint((i + 1) % NumWaypoints);
+
+		TArray<FVector> LegPoints;
+		if (NavSys)
+		{
+			// One-off synchronous query per leg; cached for the lifetime of the route.
+			UNavigationPath* Path = NavSys->FindPathToLocationSynchronously(
+				World, Start, End, const_cast<AActor*>(NavAgent));
+			if (Path && Path->IsValid() && Path->PathPoints.Num() >= 2)
+			{
+				LegPoints = Path->PathPoints;
+			}
+		}
+
+		if (LegPoints.Num() < 2)
+		{
+			// No navmesh path -- fall back to the straight line between waypoints
+			LegPoints = { Start, End };
+		}
+
+		Legs[i].Build(MoveTemp(LegPoints));
+	}
+
+	UE_LOG(LogSerene, Log, TEXT("PatrolRoute [%s]: Built patrol graph (%d legs)"), *GetName(), Legs.Num());
+}
+
+const FPatrolPolyline* APatrolRouteActor::FindLeg(int32 FromIndex, int32 ToIndex, bool& bOutReverse) const
+{
+	bOutReverse = false;
+
+	const int32 NumWaypoints = Legs.Num();
+	if (NumWaypoints < 2 || !Legs.IsValidIndex(FromIndex) || !Legs.IsValidIndex(ToIndex))
+	{
+		return nullptr;
+	}
+
+	if ((FromIndex + 1) % NumWaypoints == ToIndex)
+	{
+		return &Legs[FromIndex];
+	}
+
+	if ((ToIndex + 1) % NumWaypoints == FromIndex)
+	{
+		bOutReverse = true;
+		return &Legs[ToIndex];
+	}
+
+	return nullptr;
+}
+
 #if WITH_EDITOR
 void APatrolRouteActor::Tick(float DeltaTime)
 {
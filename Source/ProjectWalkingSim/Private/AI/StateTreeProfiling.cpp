@@ -0,0 +1,234 @@
+// Copyright Null Lantern.
+
+#include "AI/StateTreeProfiling.h"
+
+#if SERENE_AI_PROFILING
+
+#include "HAL/IConsoleManager.h"
+#include "Misc/OutputDevice.h"
+#include "Misc/TraceBookmark.h"
+#include "Core/SereneLogChannels.h"
+
+namespace
+{
+	TAutoConsoleVariable<int32> CVarAIProfile(
+		TEXT("Serene.AI.Profile"),
+		1,
+		TEXT("Record StateTree task/condition timings for Serene.AI.ProfileDump and budget warnings."),
+		ECVF_Default);
+
+	TAutoConsoleVariable<float> CVarDefaultTaskBudgetMs(
+		TEXT("Serene.AI.DefaultTaskBudgetMs"),
+		0.0f,
+		TEXT("Warn when a single StateTree task/condition call exceeds this many ms (0 = off)."),
+		ECVF_Default);
+
+	/** Parsed Serene.AI.TaskBudgets: node name -> budget ms. */
+	TMap<FString, float>& GetBudgetOverrides()
+	{
+		static TMap<FString, float> Overrides;
+		return Overrides;
+	}
+
+	/** Registry storage. Unique pointers keep node references stable across growth. */
+	TArray<TUniquePtr<FSereneAIProfileNode>>& GetNodes()
+	{
+		static TArray<TUniquePtr<FSereneAIProfileNode>> Nodes;
+		return Nodes;
+	}
+
+	void ApplyBudgetOverride(FSereneAIProfileNode& Node)
+	{
+		const float* Override = GetBudgetOverrides().Find(Node.Name);
+		Node.BudgetMs = Override ? *Override : -1.0f;
+	}
+
+	void OnTaskBudgetsChanged(IConsoleVariable* Var)
+	{
+		TMap<FString, float>& Overrides = GetBudgetOverrides();
+		Overrides.Reset();
+
+		TArray<FString> Entries;
+		Var->GetString().ParseIntoArray(Entries, TEXT(","));
+		for (const FString& Entry : Entries)
+		{
+			FString Name;
+			FString Value;
+			if (Entry.Split(TEXT("="), &Name, &Value))
+			{
+				Overrides.Add(Name.TrimStartAndEnd(), FCString::Atof(*Value.TrimStartAndEnd()));
+			}
+		}
+
+		for (const TUniquePtr<FSereneAIProfileNode>& Node : GetNodes())
+		{
+			ApplyBudgetOverride(*Node);
+		}
+	}
+
+	TAutoConsoleVariable<FString> CVarTaskBudgets(
+		TEXT("Serene.AI.TaskBudgets"),
+		TEXT(""),
+		TEXT("Per-node budget overrides in ms, e.g. \"STT_SearchArea=0.5,STC_SuspicionLevel=0.05\"."),
+		FConsoleVariableDelegate::CreateStatic(&OnTaskBudgetsChanged),
+		ECVF_Default);
+
+	/** Histogram bucket 0 is < 1us, bucket i is [2^(i-1), 2^i) us, the last bucket is open-ended. */
+	constexpr int32 NumHistogramBuckets = 14;
+
+	void DumpProfile(FOutputDevice& Ar)
+	{
+		const double MsPerCycle = FPlatformTime::GetSecondsPerCycle() * 1000.0;
+
+		Ar.Logf(TEXT("Serene AI profile (rolling window of %d calls per node/phase)"), FSereneAIProfileNode::WindowSize);
+		Ar.Logf(TEXT("%-32s %-14s %8s %9s %9s %9s %9s  histogram [<1us .. >=4ms]"),
+			TEXT("Node"), TEXT("Phase"), TEXT("Calls"), TEXT("Avg ms"), TEXT("P50 ms"), TEXT("P95 ms"), TEXT("Max ms"));
+
+		TArray<uint32> Sorted;
+		for (const TUniquePtr<FSereneAIProfileNode>& Node : GetNodes())
+		{
+			for (int32 PhaseIndex = 0; PhaseIndex < UE_ARRAY_COUNT(Node->Phases); ++PhaseIndex)
+			{
+				const FSereneAIProfileNode::FPhaseSamples& Samples = Node->Phases[PhaseIndex];
+				if (Samples.Cycles.Num() == 0)
+				{
+					continue;
+				}
+
+				Sorted = Samples.Cycles;
+				Sorted.Sort();
+
+				uint64 Sum = 0;
+				int32 Buckets[NumHistogramBuckets] = {};
+				for (const uint32 Cycles : Sorted)
+				{
+					Sum += Cycles;
+					const double Micros = Cycles * MsPerCycle * 1000.0;
+					const int32 Bucket = Micros < 1.0
+						? 0
+						: FMath::Min(NumHistogramBuckets - 1, 1 + FMath::FloorToInt32(FMath::Log2(Micros)));
+					++Buckets[Bucket];
+				}
+
+				FString Histogram;
+				for (const int32 Count : Buckets)
+				{
+					Histogram += FString::Printf(TEXT("%d "), Count);
+				}
+
+				const int32 Num = Sorted.Num();
+				Ar.Logf(TEXT("%-32s %-14s %8llu %9.4f %9.4f %9.4f %9.4f  %s"),
+					*Node->Name,
+					SereneAIProfiling::GetPhaseName(static_cast<ESereneAIProfilePhase>(PhaseIndex)),
+					Samples.TotalCount,
+					static_cast<double>(Sum) / Num * MsPerCycle,
+					Sorted[Num / 2] * MsPerCycle,
+					Sorted[FMath::Min(Num - 1, (Num * 95) / 100)] * MsPerCycle,
+					Samples.MaxCycles * MsPerCycle,
+					*Histogram);
+			}
+		}
+	}
+
+	FAutoConsoleCommandWithOutputDevice ProfileDumpCommand(
+		TEXT("Serene.AI.ProfileDump"),
+		TEXT("Print rolling timing statistics for every StateTree task and condition."),
+		FConsoleCommandWithOutputDeviceDelegate::CreateStatic(&DumpProfile));
+
+	FAutoConsoleCommand ProfileResetCommand(
+		TEXT("Serene.AI.ProfileReset"),
+		TEXT("Clear StateTree task/condition timing windows."),
+		FConsoleCommandDelegate::CreateStatic(&SereneAIProfiling::ResetAll));
+}
+
+FSereneAIProfileNode& SereneAIProfiling::RegisterNode(const TCHAR* Name)
+{
+	check(IsInGameThread());
+
+	for (const TUniquePtr<FSereneAIProfileNode>& Node : GetNodes())
+	{
+		if (Node->Name == Name)
+		{
+			return *Node;
+		}
+	}
+
+	TUniquePtr<FSereneAIProfileNode>& NewNode = GetNodes().Add_GetRef(MakeUnique<FSereneAIProfileNode>());
+	NewNode->Name = Name;
+	ApplyBudgetOverride(*NewNode);
+	return *NewNode;
+}
+
+bool SereneAIProfiling::IsEnabled()
+{
+	return CVarAIProfile.GetValueOnGameThread() != 0;
+}
+
+void SereneAIProfiling::ForEachNode(TFunctionRef<void(const FSereneAIProfileNode&)> Visitor)
+{
+	for (const TUniquePtr<FSereneAIProfileNode>& Node : GetNodes())
+	{
+		Visitor(*Node);
+	}
+}
+
+void SereneAIProfiling::ResetAll()
+{
+	for (const TUniquePtr<FSereneAIProfileNode>& Node : GetNodes())
+	{
+		for (FSereneAIProfileNode::FPhaseSamples& Samples : Node->Phases)
+		{
+			Samples = FSereneAIProfileNode::FPhaseSamples();
+		}
+	}
+}
+
+const TCHAR* SereneAIProfiling::GetPhaseName(ESereneAIProfilePhase Phase)
+{
+	switch (Phase)
+	{
+	case ESereneAIProfilePhase::EnterState:    return TEXT("EnterState");
+	case ESereneAIProfilePhase::Tick:          return TEXT("Tick");
+	case ESereneAIProfilePhase::ExitState:     return TEXT("ExitState");
+	case ESereneAIProfilePhase::TestCondition: return TEXT("TestCondition");
+	default:                                   return TEXT("?");
+	}
+}
+
+void SereneAIProfiling::RecordSample(FSereneAIProfileNode& Node, ESereneAIProfilePhase Phase, uint32 Cycles)
+{
+	FSereneAIProfileNode::FPhaseSamples& Samples = Node.Phases[static_cast<int32>(Phase)];
+
+	if (Samples.Cycles.Num() < FSereneAIProfileNode::WindowSize)
+	{
+		Samples.Cycles.Add(Cycles);
+	}
+	else
+	{
+		Samples.Cycles[Samples.NextIndex] = Cycles;
+		Samples.NextIndex = (Samples.NextIndex + 1) % FSereneAIProfileNode::WindowSize;
+	}
+	++Samples.TotalCount;
+	Samples.TotalCycles += Cycles;
+	Samples.MaxCycles = FMath::Max(Samples.MaxCycles, Cycles);
+
+	const float BudgetMs = Node.BudgetMs >= 0.0f ? Node.BudgetMs : CVarDefaultTaskBudgetMs.GetValueOnGameThread();
+	if (BudgetMs <= 0.0f)
+	{
+		return;
+	}
+
+	const double ElapsedMs = FPlatformTime::ToMilliseconds(Cycles);
+	const double Now = FPlatformTime::Seconds();
+	if (ElapsedMs > BudgetMs && Now - Node.LastBudgetWarningTime >= 1.0)
+	{
+		Node.LastBudgetWarningTime = Now;
+
+		UE_LOG(LogSerene, Warning, TEXT("AI budget exceeded: %s::%s took %.3f ms (budget %.3f ms)"),
+			*Node.Name, GetPhaseName(Phase), ElapsedMs, BudgetMs);
+		TRACE_BOOKMARK(TEXT("AI budget exceeded: %s::%s %.3f ms"),
+			*Node.Name, GetPhaseName(Phase), ElapsedMs);
+	}
+}
+
+#endif // SERENE_AI_PROFILING
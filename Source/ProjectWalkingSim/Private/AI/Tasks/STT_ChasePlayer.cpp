@@ -1,6 +1,8 @@
 // Copyright Null Lantern.
 
 #include "AI/Tasks/STT_ChasePlayer.h"
+#include "AI/StateTreeProfiling.h"
+#include "AI/AIDecisionTrace.h"
 #include "AIController.h"
 #include "AI/WendigoCharacter.h"
 #include "AI/SuspicionComponent.h"
@@ -8,8 +10,20 @@
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Navigation/PathFollowingComponent.h"
 #include "Kismet/GameplayStatics.h"
+#include "AITypes.h"
 #include "Core/SereneLogChannels.h"
 
+namespace
+{
+	/** Where the Wendigo should run to: the player's predicted intercept point. */
+	FVector ComputeChaseGoal(const APawn& Pawn, const AActor& Target, float ChaseSpeed, float MaxPredictionTime)
+	{
+		return FWendigoChasePlanner::PredictInterceptPoint(
+			Pawn.GetActorLocation(), ChaseSpeed,
+			Target.GetActorLocation(), Target.GetVelocity(), MaxPredictionTime);
+	}
+}
+
 bool FSTT_ChasePlayer::Link(FStateTreeLinker& Linker)
 {
 	Linker.LinkExternalData(ControllerHandle);
@@ -20,6 +34,9 @@ EStateTreeRunStatus FSTT_ChasePlayer::EnterState(
 	FStateTreeExecutionContext& Context,
 	const FStateTreeTransitionResult& Transition) const
 {
+	SERENE_AI_PROFILE_SCOPE(STT_ChasePlayer, EnterState);
+	SERENE_AI_TRACE_TASK_ENTER(STT_ChasePlayer);
+
 	FInstanceDataType& InstanceData = Context.GetInstanceData<FInstanceDataType>(*this);
 	AAIController& Controller = Context.GetExternalData(ControllerHandle);
 
@@ -53,12 +70,15 @@ EStateTreeRunStatus FSTT_ChasePlayer::EnterState(
 	// Set focus on chase target for head tracking
 	Controller.SetFocus(PlayerPawn, EAIFocusPriority::Gameplay);
 
-	// Issue MoveToActor -- auto-updates destination as player moves
-	const EPathFollowingRequestResult::Type MoveResult = Controller.MoveToActor(
-		PlayerPawn,
+	// Initial move is synchronous so the Wendigo starts running this frame.
+	// Later replans go through the planner's async queries (see Tick).
+	const FVector Goal = ComputeChaseGoal(*Pawn, *PlayerPawn, ChaseSpeed, MaxPredictionTime);
+	const EPathFollowingRequestResult::Type MoveResult = Controller.MoveToLocation(
+		Goal,
 		AcceptanceRadius,
 		/*bStopOnOverlap=*/ true,
 		/*bUsePathfinding=*/ true,
+		/*bProjectDestinationToNavigation=*/ true,
 		/*bCanStrafe=*/ true,
 		/*FilterClass=*/ nullptr,
 		/*bAllowPartialPath=*/ true
@@ -66,12 +86,15 @@ EStateTreeRunStatus FSTT_ChasePlayer::EnterState(
 
 	if (MoveResult == EPathFollowingRequestResult::Failed)
 	{
-		UE_LOG(LogSerene, Warning, TEXT("ChasePlayer: MoveToActor failed, storing last-known location"));
+		UE_LOG(LogSerene, Warning, TEXT("ChasePlayer: MoveToLocation failed, storing last-known location"));
 		// Fall back: store current player location so Search can use it
 		Wendigo->SetLastKnownPlayerLocation(PlayerPawn->GetActorLocation());
 		return EStateTreeRunStatus::Failed;
 	}
 
+	InstanceData.Planner.Reset();
+	InstanceData.Planner.SetCurrentGoal(Goal, Wendigo->GetWorld()->GetTimeSeconds());
+	InstanceData.ChaseElapsed = 0.0f;
 	InstanceData.bMoveRequestActive = (MoveResult == EPathFollowingRequestResult::RequestSuccessful);
 	InstanceData.LOSLostTimer = 0.0f;
 
@@ -82,6 +105,8 @@ EStateTreeRunStatus FSTT_ChasePlayer::Tick(
 	FStateTreeExecutionContext& Context,
 	const float DeltaTime) const
 {
+	SERENE_AI_PROFILE_SCOPE(STT_ChasePlayer, Tick);
+
 	FInstanceDataType& InstanceData = Context.GetInstanceData<FInstanceDataType>(*this);
 	AAIController& Controller = Context.GetExternalData(ControllerHandle);
 
@@ -137,21 +162,45 @@ EStateTreeRunStatus FSTT_ChasePlayer::Tick(
 		return EStateTreeRunStatus::Succeeded;
 	}
 
-	// Re-issue MoveToActor if path following went idle mid-chase
-	// (handles player temporarily leaving NavMesh or path invalidation)
-	const EPathFollowingStatus::Type MoveStatus = Controller.GetMoveStatus();
-	if (MoveStatus != EPathFollowingStatus::Moving && InstanceData.bMoveRequestActive)
+	InstanceData.ChaseElapsed += DeltaTime;
+	FWendigoChasePlanner& Planner = InstanceData.Planner;
+
+	// Swap in a completed async path. Path following continues seamlessly from the new corridor.
+	FNavPathSharedPtr NewPath;
+	if (Planner.ConsumeResult(NewPath) && NewPath.IsValid())
 	{
-		const EPathFollowingRequestResult::Type MoveResult = Controller.MoveToActor(
-			Target,
+		FAIMoveRequest MoveRequest(Planner.GetCurrentGoal());
+		MoveRequest.SetAcceptanceRadius(AcceptanceRadius);
+		MoveRequest.SetReachTestIncludesAgentRadius(true);
+		MoveRequest.SetCanStrafe(true);
+		MoveRequest.SetAllowPartialPath(true);
+
+		InstanceData.bMoveRequestActive = Controller.RequestMove(MoveRequest, NewPath).IsValid();
+	}
+
+	// Replan only when the intercept goal drifts out of the (distance-scaled) tolerance,
+	// or path following went idle (goal reached, player left NavMesh, path invalidated).
+	const double Now = Wendigo->GetWorld()->GetTimeSeconds();
+	const bool bPathIdle = Controller.GetMoveStatus() != EPathFollowingStatus::Moving;
+	const FVector Goal = ComputeChaseGoal(*Pawn, *Target, ChaseSpeed, MaxPredictionTime);
+	const float Tolerance = GoalTolerance + DistToTarget * GoalToleranceDistanceScale;
+
+	if (Planner.ShouldRepath(Goal, Now, Tolerance, MinRepathInterval, bPathIdle)
+		&& !Planner.RequestPathAsync(Controller, Goal, Now))
+	{
+		// No nav data for an async query -- fall back to a direct synchronous move
+		const EPathFollowingRequestResult::Type MoveResult = Controller.MoveToLocation(
+			Goal,
 			AcceptanceRadius,
 			/*bStopOnOverlap=*/ true,
 			/*bUsePathfinding=*/ true,
+			/*bProjectDestinationToNavigation=*/ true,
 			/*bCanStrafe=*/ true,
 			/*FilterClass=*/ nullptr,
 			/*bAllowPartialPath=*/ true
 		);
 
+		Planner.SetCurrentGoal(Goal, Now);
 		InstanceData.bMoveRequestActive = (MoveResult == EPathFollowingRequestResult::RequestSuccessful);
 	}
 
@@ -162,6 +211,8 @@ void FSTT_ChasePlayer::ExitState(
 	FStateTreeExecutionContext& Context,
 	const FStateTreeTransitionResult& Transition) const
 {
+	SERENE_AI_PROFILE_SCOPE(STT_ChasePlayer, ExitState);
+
 	FInstanceDataType& InstanceData = Context.GetInstanceData<FInstanceDataType>(*this);
 	AAIController& Controller = Context.GetExternalData(ControllerHandle);
 
@@ -185,4 +236,8 @@ void FSTT_ChasePlayer::ExitState(
 
 	// Clear focus
 	Controller.ClearFocus(EAIFocusPriority::Gameplay);
+
+	UE_LOG(LogSerene, Verbose, TEXT("ChasePlayer: %d path queries over %.1fs"),
+		InstanceData.Planner.GetNumQueries(), InstanceData.ChaseElapsed);
+	InstanceData.Planner.Reset();
 }
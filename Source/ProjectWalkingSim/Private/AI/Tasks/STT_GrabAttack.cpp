@@ -1,6 +1,8 @@
 // Copyright Null Lantern.
 
 #include "AI/Tasks/STT_GrabAttack.h"
+#include "AI/StateTreeProfiling.h"
+#include "AI/AIDecisionTrace.h"
 #include "AIController.h"
 #include "AI/WendigoCharacter.h"
 #include "AI/MonsterAITypes.h"
@@ -19,6 +21,9 @@ EStateTreeRunStatus FSTT_GrabAttack::EnterState(
 	FStateTreeExecutionContext& Context,
 	const FStateTreeTransitionResult& Transition) const
 {
+	SERENE_AI_PROFILE_SCOPE(STT_GrabAttack, EnterState);
+	SERENE_AI_TRACE_TASK_ENTER(STT_GrabAttack);
+
 	FInstanceDataType& InstanceData = Context.GetInstanceData<FInstanceDataType>(*this);
 	AAIController& Controller = Context.GetExternalData(ControllerHandle);
 
@@ -66,6 +71,8 @@ EStateTreeRunStatus FSTT_GrabAttack::Tick(
 	FStateTreeExecutionContext& Context,
 	const float DeltaTime) const
 {
+	SERENE_AI_PROFILE_SCOPE(STT_GrabAttack, Tick);
+
 	FInstanceDataType& InstanceData = Context.GetInstanceData<FInstanceDataType>(*this);
 
 	InstanceData.ElapsedTime += DeltaTime;
@@ -93,6 +100,8 @@ void FSTT_GrabAttack::ExitState(
 	FStateTreeExecutionContext& Context,
 	const FStateTreeTransitionResult& Transition) const
 {
+	SERENE_AI_PROFILE_SCOPE(STT_GrabAttack, ExitState);
+
 	FInstanceDataType& InstanceData = Context.GetInstanceData<FInstanceDataType>(*this);
 	AAIController& Controller = Context.GetExternalData(ControllerHandle);
 
@@ -1,6 +1,8 @@
 // Copyright Null Lantern.
 
 #include "AI/Tasks/STT_InvestigateLocation.h"
+#include "AI/StateTreeProfiling.h"
+#include "AI/AIDecisionTrace.h"
 #include "AIController.h"
 #include "AI/WendigoCharacter.h"
 #include "AI/SuspicionComponent.h"
@@ -19,6 +21,9 @@ EStateTreeRunStatus FSTT_InvestigateLocation::EnterState(
 	FStateTreeExecutionContext& Context,
 	const FStateTreeTransitionResult& Transition) const
 {
+	SERENE_AI_PROFILE_SCOPE(STT_InvestigateLocation, EnterState);
+	SERENE_AI_TRACE_TASK_ENTER(STT_InvestigateLocation);
+
 	FInstanceDataType& InstanceData = Context.GetInstanceData<FInstanceDataType>(*this);
 	AAIController& Controller = Context.GetExternalData(ControllerHandle);
 
@@ -94,6 +99,8 @@ EStateTreeRunStatus FSTT_InvestigateLocation::Tick(
 	FStateTreeExecutionContext& Context,
 	const float DeltaTime) const
 {
+	SERENE_AI_PROFILE_SCOPE(STT_InvestigateLocation, Tick);
+
 	FInstanceDataType& InstanceData = Context.GetInstanceData<FInstanceDataType>(*this);
 	AAIController& Controller = Context.GetExternalData(ControllerHandle);
 
@@ -136,6 +143,8 @@ void FSTT_InvestigateLocation::ExitState(
 	FStateTreeExecutionContext& Context,
 	const FStateTreeTransitionResult& Transition) const
 {
+	SERENE_AI_PROFILE_SCOPE(STT_InvestigateLocation, ExitState);
+
 	FInstanceDataType& InstanceData = Context.GetInstanceData<FInstanceDataType>(*this);
 	AAIController& Controller = Context.GetExternalData(ControllerHandle);
 
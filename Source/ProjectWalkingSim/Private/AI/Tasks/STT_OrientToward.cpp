@@ -1,6 +1,8 @@
 // Copyright Null Lantern.
 
 #include "AI/Tasks/STT_OrientToward.h"
+#include "AI/StateTreeProfiling.h"
+#include "AI/AIDecisionTrace.h"
 #include "AIController.h"
 #include "AI/WendigoCharacter.h"
 #include "AI/SuspicionComponent.h"
@@ -16,6 +18,9 @@ EStateTreeRunStatus FSTT_OrientToward::EnterState(
 	FStateTreeExecutionContext& Context,
 	const FStateTreeTransitionResult& Transition) const
 {
+	SERENE_AI_PROFILE_SCOPE(STT_OrientToward, EnterState);
+	SERENE_AI_TRACE_TASK_ENTER(STT_OrientToward);
+
 	FInstanceDataType& InstanceData = Context.GetInstanceData<FInstanceDataType>(*this);
 	AAIController& Controller = Context.GetExternalData(ControllerHandle);
 
@@ -57,6 +62,8 @@ EStateTreeRunStatus FSTT_OrientToward::Tick(
 	FStateTreeExecutionContext& Context,
 	const float DeltaTime) const
 {
+	SERENE_AI_PROFILE_SCOPE(STT_OrientToward, Tick);
+
 	FInstanceDataType& InstanceData = Context.GetInstanceData<FInstanceDataType>(*this);
 
 	// Pawn rotates toward focal point automatically via AAIController::UpdateControlRotation
@@ -74,6 +81,8 @@ void FSTT_OrientToward::ExitState(
 	FStateTreeExecutionContext& Context,
 	const FStateTreeTransitionResult& Transition) const
 {
+	SERENE_AI_PROFILE_SCOPE(STT_OrientToward, ExitState);
+
 	AAIController& Controller = Context.GetExternalData(ControllerHandle);
 
 	// Clear the gameplay focal point so other behaviors can set their own focus
@@ -1,6 +1,8 @@
 // Copyright Null Lantern.
 
 #include "AI/Tasks/STT_PatrolIdle.h"
+#include "AI/StateTreeProfiling.h"
+#include "AI/AIDecisionTrace.h"
 #include "AIController.h"
 #include "Core/SereneLogChannels.h"
 
@@ -14,6 +16,9 @@ EStateTreeRunStatus FSTT_PatrolIdle::EnterState(
 	FStateTreeExecutionContext& Context,
 	const FStateTreeTransitionResult& Transition) const
 {
+	SERENE_AI_PROFILE_SCOPE(STT_PatrolIdle, EnterState);
+	SERENE_AI_TRACE_TASK_ENTER(STT_PatrolIdle);
+
 	FInstanceDataType& InstanceData = Context.GetInstanceData<FInstanceDataType>(*this);
 
 	// Randomize idle duration
@@ -32,6 +37,8 @@ EStateTreeRunStatus FSTT_PatrolIdle::Tick(
 	FStateTreeExecutionContext& Context,
 	const float DeltaTime) const
 {
+	SERENE_AI_PROFILE_SCOPE(STT_PatrolIdle, Tick);
+
 	FInstanceDataType& InstanceData = Context.GetInstanceData<FInstanceDataType>(*this);
 	AAIController& Controller = Context.GetExternalData(ControllerHandle);
 
@@ -81,6 +88,8 @@ void FSTT_PatrolIdle::ExitState(
 	FStateTreeExecutionContext& Context,
 	const FStateTreeTransitionResult& Transition) const
 {
+	SERENE_AI_PROFILE_SCOPE(STT_PatrolIdle, ExitState);
+
 	AAIController& Controller = Context.GetExternalData(ControllerHandle);
 	Controller.ClearFocus(EAIFocusPriority::Gameplay);
 }
@@ -1,6 +1,8 @@
 // Copyright Null Lantern.
 
 #include "AI/Tasks/STT_PatrolMoveToWaypoint.h"
+#include "AI/StateTreeProfiling.h"
+#include "AI/AIDecisionTrace.h"
 #include "AIController.h"
 #include "AI/WendigoCharacter.h"
 #include "AI/PatrolRouteActor.h"
@@ -17,6 +19,9 @@ EStateTreeRunStatus FSTT_PatrolMoveToWaypoint::EnterState(
 	FStateTreeExecutionContext& Context,
 	const FStateTreeTransitionResult& Transition) const
 {
+	SERENE_AI_PROFILE_SCOPE(STT_PatrolMoveToWaypoint, EnterState);
+	SERENE_AI_TRACE_TASK_ENTER(STT_PatrolMoveToWaypoint);
+
 	FInstanceDataType& InstanceData = Context.GetInstanceData<FInstanceDataType>(*this);
 	AAIController& Controller = Context.GetExternalData(ControllerHandle);
 
@@ -28,7 +33,23 @@ EStateTreeRunStatus FSTT_PatrolMoveToWaypoint::EnterState(
 		return EStateTreeRunStatus::Failed;
 	}
 
-	APatrolRouteActor* PatrolRoute = Wendigo->GetPatrolRoute();
+	// Started paused while parked (pool, level reset): route and position are not final yet.
+	// Tick issues the move once the tree is resumed.
+	if (Wendigo->IsDormant())
+	{
+		InstanceData.bMoveRequestActive = false;
+		return EStateTreeRunStatus::Running;
+	}
+
+	return RequestMove(Controller, *Wendigo, InstanceData);
+}
+
+EStateTreeRunStatus FSTT_PatrolMoveToWaypoint::RequestMove(
+	AAIController& Controller,
+	AWendigoCharacter& Wendigo,
+	FInstanceDataType& InstanceData) const
+{
+	APatrolRouteActor* PatrolRoute = Wendigo.GetPatrolRoute();
 	if (!PatrolRoute || PatrolRoute->GetNumWaypoints() == 0)
 	{
 		UE_LOG(LogSerene, Warning, TEXT("PatrolMoveToWaypoint: No patrol route or empty waypoints"));
@@ -36,7 +57,7 @@ EStateTreeRunStatus FSTT_PatrolMoveToWaypoint::EnterState(
 	}
 
 	// Read waypoint index from character (persists across state re-entries)
-	const FVector TargetLocation = PatrolRoute->GetWaypoint(Wendigo->CurrentWaypointIndex);
+	const FVector TargetLocation = PatrolRoute->GetWaypoint(Wendigo.CurrentWaypointIndex);
 
 	// Issue move request. Do NOT set bLockAILogic (prevents State Tree transitions).
 	const EPathFollowingRequestResult::Type MoveResult = Controller.MoveToLocation(
@@ -53,14 +74,14 @@ EStateTreeRunStatus FSTT_PatrolMoveToWaypoint::EnterState(
 	if (MoveResult == EPathFollowingRequestResult::Failed)
 	{
 		UE_LOG(LogSerene, Warning, TEXT("PatrolMoveToWaypoint: MoveToLocation failed for waypoint %d at %s"),
-			Wendigo->CurrentWaypointIndex, *TargetLocation.ToString());
+			Wendigo.CurrentWaypointIndex, *TargetLocation.ToString());
 		return EStateTreeRunStatus::Failed;
 	}
 
 	if (MoveResult == EPathFollowingRequestResult::AlreadyAtGoal)
 	{
 		// Already at waypoint -- advance index and succeed immediately
-		Wendigo->CurrentWaypointIndex = PatrolRoute->GetNextWaypointIndex(Wendigo->CurrentWaypointIndex);
+		Wendigo.CurrentWaypointIndex = PatrolRoute->GetNextWaypointIndex(Wendigo.CurrentWaypointIndex);
 		InstanceData.bMoveRequestActive = false;
 		return EStateTreeRunStatus::Succeeded;
 	}
@@ -73,9 +94,18 @@ EStateTreeRunStatus FSTT_PatrolMoveToWaypoint::Tick(
 	FStateTreeExecutionContext& Context,
 	const float DeltaTime) const
 {
+	SERENE_AI_PROFILE_SCOPE(STT_PatrolMoveToWaypoint, Tick);
+
 	FInstanceDataType& InstanceData = Context.GetInstanceData<FInstanceDataType>(*this);
 	AAIController& Controller = Context.GetExternalData(ControllerHandle);
 
+	// Entered while parked: the move has not been requested yet.
+	if (!InstanceData.bMoveRequestActive)
+	{
+		AWendigoCharacter* Wendigo = Cast<AWendigoCharacter>(Controller.GetPawn());
+		return Wendigo ? RequestMove(Controller, *Wendigo, InstanceData) : EStateTreeRunStatus::Failed;
+	}
+
 	const EPathFollowingStatus::Type MoveStatus = Controller.GetMoveStatus();
 
 	if (MoveStatus == EPathFollowingStatus::Moving)
@@ -103,6 +133,8 @@ void FSTT_PatrolMoveToWaypoint::ExitState(
 	FStateTreeExecutionContext& Context,
 	const FStateTreeTransitionResult& Transition) const
 {
+	SERENE_AI_PROFILE_SCOPE(STT_PatrolMoveToWaypoint, ExitState);
+
 	FInstanceDataType& InstanceData = Context.GetInstanceData<FInstanceDataType>(*this);
 
 	if (InstanceData.bMoveRequestActive)
@@ -1,6 +1,8 @@
 // Copyright Null Lantern.
 
 #include "AI/Tasks/STT_ReturnToNearestWaypoint.h"
+#include "AI/StateTreeProfiling.h"
+#include "AI/AIDecisionTrace.h"
 #include "AIController.h"
 #include "AI/WendigoCharacter.h"
 #include "AI/PatrolRouteActor.h"
@@ -19,6 +21,9 @@ EStateTreeRunStatus FSTT_ReturnToNearestWaypoint::EnterState(
 	FStateTreeExecutionContext& Context,
 	const FStateTreeTransitionResult& Transition) const
 {
+	SERENE_AI_PROFILE_SCOPE(STT_ReturnToNearestWaypoint, EnterState);
+	SERENE_AI_TRACE_TASK_ENTER(STT_ReturnToNearestWaypoint);
+
 	FInstanceDataType& InstanceData = Context.GetInstanceData<FInstanceDataType>(*this);
 	AAIController& Controller = Context.GetExternalData(ControllerHandle);
 
@@ -102,6 +107,8 @@ EStateTreeRunStatus FSTT_ReturnToNearestWaypoint::Tick(
 	FStateTreeExecutionContext& Context,
 	const float DeltaTime) const
 {
+	SERENE_AI_PROFILE_SCOPE(STT_ReturnToNearestWaypoint, Tick);
+
 	FInstanceDataType& InstanceData = Context.GetInstanceData<FInstanceDataType>(*this);
 	AAIController& Controller = Context.GetExternalData(ControllerHandle);
 
@@ -121,6 +128,8 @@ void FSTT_ReturnToNearestWaypoint::ExitState(
 	FStateTreeExecutionContext& Context,
 	const FStateTreeTransitionResult& Transition) const
 {
+	SERENE_AI_PROFILE_SCOPE(STT_ReturnToNearestWaypoint, ExitState);
+
 	FInstanceDataType& InstanceData = Context.GetInstanceData<FInstanceDataType>(*this);
 
 	if (InstanceData.bMoveRequestActive)
@@ -1,12 +1,16 @@
 // Copyright Null Lantern.
 
 #include "AI/Tasks/STT_SearchArea.h"
+#include "AI/StateTreeProfiling.h"
+#include "AI/AIDecisionTrace.h"
 #include "AIController.h"
 #include "AI/WendigoCharacter.h"
 #include "AI/MonsterAITypes.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Navigation/PathFollowingComponent.h"
 #include "NavigationSystem.h"
+#include "AI/HidingSpotIndexSubsystem.h"
+#include "Hiding/HidingSpotActor.h"
 #include "Core/SereneLogChannels.h"
 
 bool FSTT_SearchArea::Link(FStateTreeLinker& Linker)
@@ -19,6 +23,9 @@ EStateTreeRunStatus FSTT_SearchArea::EnterState(
 	FStateTreeExecutionContext& Context,
 	const FStateTreeTransitionResult& Transition) const
 {
+	SERENE_AI_PROFILE_SCOPE(STT_SearchArea, EnterState);
+	SERENE_AI_TRACE_TASK_ENTER(STT_SearchArea);
+
 	FInstanceDataType& InstanceData = Context.GetInstanceData<FInstanceDataType>(*this);
 	AAIController& Controller = Context.GetExternalData(ControllerHandle);
 
@@ -41,6 +48,7 @@ EStateTreeRunStatus FSTT_SearchArea::EnterState(
 
 	// Build search points array
 	InstanceData.SearchPoints.Reset();
+	InstanceData.SearchPointSpots.Reset();
 
 	// First point: last-known player location (or current position as fallback)
 	FVector SearchOrigin;
@@ -54,6 +62,32 @@ EStateTreeRunStatus FSTT_SearchArea::EnterState(
 		UE_LOG(LogSerene, Verbose, TEXT("SearchArea: No last-known location, using pawn position as fallback"));
 	}
 	InstanceData.SearchPoints.Add(SearchOrigin);
+	InstanceData.SearchPointSpots.Add(nullptr);
+
+	// Hiding spots most worth checking near the origin (witnessed spot always first)
+	UHidingSpotIndexSubsystem* SpotIndex = Wendigo->GetWorld()->GetSubsystem<UHidingSpotIndexSubsystem>();
+	if (SpotIndex && NumHidingSpotsToCheck > 0)
+	{
+		FHidingSpotQuery Query;
+		Query.Origin = SearchOrigin;
+		Query.Radius = SearchRadius;
+		Query.MaxResults = NumHidingSpotsToCheck;
+		Query.TypeWeights = &SpotTypeWeights;
+		Query.RecheckCooldown = SpotRecheckCooldown;
+		Query.PrioritySpot = Wendigo->WitnessedHidingSpot.Get();
+		Query.Querier = Wendigo;
+
+		TArray<FHidingSpotCandidate> Candidates;
+		SpotIndex->FindBestSpots(Query, Candidates);
+		for (const FHidingSpotCandidate& Candidate : Candidates)
+		{
+			InstanceData.SearchPoints.Add(Candidate.ApproachPoint);
+			InstanceData.SearchPointSpots.Add(Candidate.Spot.Get());
+
+			UE_LOG(LogSerene, Verbose, TEXT("SearchArea: Checking hiding spot %s (score %.2f, path %.0f cm)"),
+				*GetNameSafe(Candidate.Spot.Get()), Candidate.Score, Candidate.PathDistance);
+		}
+	}
 
 	// Generate random NavMesh points around the search origin
 	UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(Wendigo->GetWorld());
@@ -65,6 +99,7 @@ EStateTreeRunStatus FSTT_SearchArea::EnterState(
 			if (NavSys->GetRandomReachablePointInRadius(SearchOrigin, SearchRadius, RandomPoint))
 			{
 				InstanceData.SearchPoints.Add(RandomPoint.Location);
+				InstanceData.SearchPointSpots.Add(nullptr);
 			}
 			// If a random point fails, skip it (don't pad with duplicates)
 		}
@@ -117,6 +152,8 @@ EStateTreeRunStatus FSTT_SearchArea::Tick(
 	FStateTreeExecutionContext& Context,
 	const float DeltaTime) const
 {
+	SERENE_AI_PROFILE_SCOPE(STT_SearchArea, Tick);
+
 	FInstanceDataType& InstanceData = Context.GetInstanceData<FInstanceDataType>(*this);
 	AAIController& Controller = Context.GetExternalData(ControllerHandle);
 
@@ -149,8 +186,19 @@ EStateTreeRunStatus FSTT_SearchArea::Tick(
 	InstanceData.TimeAtCurrentPoint += DeltaTime;
 	InstanceData.TimeSinceLastGlance += DeltaTime;
 
+	// At a hiding spot: stare at it for the whole linger instead of glancing around
+	AActor* CurrentSpot = InstanceData.SearchPointSpots.IsValidIndex(InstanceData.CurrentSearchIndex)
+		? InstanceData.SearchPointSpots[InstanceData.CurrentSearchIndex].Get()
+		: nullptr;
+	if (CurrentSpot)
+	{
+		if (Controller.GetFocusActor() != CurrentSpot)
+		{
+			Controller.SetFocus(CurrentSpot, EAIFocusPriority::Gameplay);
+		}
+	}
 	// Periodic look-around: change glance direction every ~2 seconds
-	if (InstanceData.TimeSinceLastGlance >= 2.0f)
+	else if (InstanceData.TimeSinceLastGlance >= 2.0f)
 	{
 		APawn* Pawn = Controller.GetPawn();
 		if (Pawn)
@@ -171,6 +219,14 @@ EStateTreeRunStatus FSTT_SearchArea::Tick(
 		// Clear focus from look-around
 		Controller.ClearFocus(EAIFocusPriority::Gameplay);
 
+		if (CurrentSpot)
+		{
+			if (UHidingSpotIndexSubsystem* SpotIndex = CurrentSpot->GetWorld()->GetSubsystem<UHidingSpotIndexSubsystem>())
+			{
+				SpotIndex->MarkChecked(CurrentSpot);
+			}
+		}
+
 		InstanceData.CurrentSearchIndex++;
 
 		if (InstanceData.CurrentSearchIndex >= InstanceData.SearchPoints.Num())
@@ -225,6 +281,8 @@ void FSTT_SearchArea::ExitState(
 	FStateTreeExecutionContext& Context,
 	const FStateTreeTransitionResult& Transition) const
 {
+	SERENE_AI_PROFILE_SCOPE(STT_SearchArea, ExitState);
+
 	FInstanceDataType& InstanceData = Context.GetInstanceData<FInstanceDataType>(*this);
 	AAIController& Controller = Context.GetExternalData(ControllerHandle);
 
@@ -3,6 +3,7 @@
 #include "AI/WendigoAIController.h"
 #include "AI/WendigoCharacter.h"
 #include "AI/SuspicionComponent.h"
+#include "AI/AIDecisionTrace.h"
 #include "Visibility/VisibilityScoreComponent.h"
 #include "Hiding/HidingComponent.h"
 #include "Hiding/HidingSpotActor.h"
@@ -13,6 +14,7 @@
 #include "Perception/AISenseConfig_Hearing.h"
 #include "Perception/AISense_Sight.h"
 #include "Perception/AISense_Hearing.h"
+#include "Navigation/PathFollowingComponent.h"
 #include "Core/SereneLogChannels.h"
 
 AWendigoAIController::AWendigoAIController()
@@ -79,13 +81,85 @@ void AWendigoAIController::OnPossess(APawn* InPawn)
 
 void AWendigoAIController::TryStartStateTree()
 {
-	if (bBeginPlayCalled && bPossessCalled && StateTreeAIComponent)
+	if (!bBeginPlayCalled || !bPossessCalled || !StateTreeAIComponent)
 	{
-		StateTreeAIComponent->StartLogic();
-		UE_LOG(LogSerene, Log, TEXT("Wendigo State Tree started"));
+		return;
+	}
+
+	if (bSimulationSuspended && !bPauseStateTreeWhileSuspended)
+	{
+		return;
+	}
+
+	StateTreeAIComponent->StartLogic();
+	UE_LOG(LogSerene, Log, TEXT("Wendigo State Tree started%s"), bSimulationSuspended ? TEXT(" (paused)") : TEXT(""));
+
+	if (bSimulationSuspended)
+	{
+		StateTreeAIComponent->PauseLogic(TEXT("Simulation suspended"));
+
+		// Whatever move the root state just requested is dropped; waking starts from Idle.
+		StopMovement();
 	}
 }
 
+void AWendigoAIController::SetSimulationSuspended(bool bSuspended, bool bPauseStateTree)
+{
+	if (bSimulationSuspended == bSuspended)
+	{
+		return;
+	}
+	bSimulationSuspended = bSuspended;
+
+	if (bSuspended)
+	{
+		StopMovement();
+		if (StateTreeAIComponent)
+		{
+			StateTreeAIComponent->StopLogic(TEXT("Simulation suspended"));
+		}
+		bPauseStateTreeWhileSuspended = bPauseStateTree;
+	}
+
+	if (AIPerceptionComponent)
+	{
+		AIPerceptionComponent->SetSenseEnabled(UAISense_Sight::StaticClass(), !bSuspended);
+		AIPerceptionComponent->SetSenseEnabled(UAISense_Hearing::StaticClass(), !bSuspended);
+	}
+
+	if (UPathFollowingComponent* PathFollowing = GetPathFollowingComponent())
+	{
+		PathFollowing->SetComponentTickEnabled(!bSuspended);
+	}
+
+	// Tick only feeds sight into suspicion -- nothing to do while senses are off.
+	SetActorTickEnabled(!bSuspended);
+	SightDebugTimer = 0.0f;
+
+	if (bSuspended)
+	{
+		// Pausing: start from the root now, while parked, so waking costs no StartLogic.
+		if (bPauseStateTree)
+		{
+			TryStartStateTree();
+		}
+	}
+	else if (bPauseStateTreeWhileSuspended && StateTreeAIComponent && StateTreeAIComponent->IsPaused())
+	{
+		bPauseStateTreeWhileSuspended = false;
+		StateTreeAIComponent->ResumeLogic(TEXT("Simulation resumed"));
+	}
+	else
+	{
+		bPauseStateTreeWhileSuspended = false;
+
+		// Restarts from the root; Patrol picks up CurrentWaypointIndex from the character.
+		TryStartStateTree();
+	}
+
+	UE_LOG(LogSerene, Log, TEXT("Wendigo AI: Simulation %s"), bSuspended ? TEXT("suspended") : TEXT("resumed"));
+}
+
 void AWendigoAIController::Tick(float DeltaTime)
 {
 	Super::Tick(DeltaTime);
@@ -108,6 +182,7 @@ void AWendigoAIController::Tick(float DeltaTime)
 	AIPerceptionComponent->GetCurrentlyPerceivedActors(UAISense_Sight::StaticClass(), CachedPerceivedActors);
 
 	bool bSeeingPlayer = false;
+	float TracedVisibility = -1.0f;
 
 	for (AActor* Actor : CachedPerceivedActors)
 	{
@@ -130,6 +205,7 @@ void AWendigoAIController::Tick(float DeltaTime)
 
 			SuspicionComp->ProcessSightStimulus(VisibilityScore, DeltaTime);
 			bSeeingPlayer = true;
+			TracedVisibility = VisibilityScore;
 
 			// Debug: log visibility score periodically (every ~1s)
 			SightDebugTimer += DeltaTime;
@@ -150,6 +226,13 @@ void AWendigoAIController::Tick(float DeltaTime)
 	{
 		SuspicionComp->DecaySuspicion(DeltaTime);
 	}
+
+#if SERENE_AI_TRACE
+	if (UAIDecisionTraceSubsystem* Trace = GetWorld()->GetSubsystem<UAIDecisionTraceSubsystem>())
+	{
+		Trace->RecordTick(*this, *WendigoChar, TrackedPlayer.Get(), TracedVisibility, DeltaTime);
+	}
+#endif
 }
 
 void AWendigoAIController::OnTargetPerceptionUpdated(AActor* Actor, FAIStimulus Stimulus)
@@ -204,6 +287,13 @@ void AWendigoAIController::ProcessHearingPerception(AActor* NoiseInstigator, FVe
 	}
 
 	SuspicionComp->ProcessHearingStimulus(StimulusLocation);
+
+#if SERENE_AI_TRACE
+	if (UAIDecisionTraceSubsystem* Trace = GetWorld()->GetSubsystem<UAIDecisionTraceSubsystem>())
+	{
+		Trace->NoteHeardNoise(*this, StimulusLocation);
+	}
+#endif
 	UE_LOG(LogSerene, Log, TEXT("Wendigo heard noise at %s"), *StimulusLocation.ToString());
 }
 
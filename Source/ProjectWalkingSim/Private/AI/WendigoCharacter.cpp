@@ -4,13 +4,18 @@
 #include "AI/SuspicionComponent.h"
 #include "AI/WendigoAIController.h"
 #include "AI/MonsterAITypes.h"
+#include "AI/WendigoSimulationLODComponent.h"
 #include "Audio/MonsterAudioComponent.h"
 #include "Audio/MusicTensionSystem.h"
 #include "Core/SereneLogChannels.h"
 #include "Components/CapsuleComponent.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "SkeletalMeshComponentBudgeted.h"
+#include "IAnimationBudgetAllocator.h"
 #include "GameFramework/CharacterMovementComponent.h"
 
-AWendigoCharacter::AWendigoCharacter()
+AWendigoCharacter::AWendigoCharacter(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer.SetDefaultSubobjectClass<USkeletalMeshComponentBudgeted>(ACharacter::MeshComponentName))
 {
 	// ---- Capsule: tall character (~260cm / ~8.5ft) ----
 	GetCapsuleComponent()->InitCapsuleSize(45.0f, 130.0f);
@@ -21,6 +26,16 @@ AWendigoCharacter::AWendigoCharacter()
 	Movement->bOrientRotationToMovement = true;
 	Movement->RotationRate = FRotator(0.0, 120.0, 0.0);
 
+	// ---- Mesh: animation budgeted by significance tier (set by SimulationLODComponent) ----
+	if (USkeletalMeshComponentBudgeted* BudgetedMesh = Cast<USkeletalMeshComponentBudgeted>(GetMesh()))
+	{
+		BudgetedMesh->SetAutoRegisterWithBudgetAllocator(true);
+		BudgetedMesh->SetAutoCalculateSignificance(false);
+	}
+	// URO and montage-only off-screen ticking take over if the budget allocator is disabled.
+	GetMesh()->bEnableUpdateRateOptimizations = true;
+	GetMesh()->VisibilityBasedAnimTickOption = EVisibilityBasedAnimTickOption::OnlyTickMontagesWhenNotRendered;
+
 	// ---- Rotation: driven by movement, not controller ----
 	bUseControllerRotationYaw = false;
 
@@ -38,6 +53,10 @@ AWendigoCharacter::AWendigoCharacter()
 
 	MusicTensionSystem = CreateDefaultSubobject<UMusicTensionSystem>(
 		TEXT("MusicTensionSystem"));
+
+	// ---- Simulation LOD: virtualise while patrolling far from the player ----
+	SimulationLODComponent = CreateDefaultSubobject<UWendigoSimulationLODComponent>(
+		TEXT("SimulationLODComponent"));
 }
 
 void AWendigoCharacter::SetBehaviorState(EWendigoBehaviorState NewState)
@@ -56,6 +75,91 @@ void AWendigoCharacter::SetBehaviorState(EWendigoBehaviorState NewState)
 	}
 }
 
+void AWendigoCharacter::SetPawnSimulationEnabled(bool bEnabled)
+{
+	SetActorHiddenInGame(!bEnabled);
+	SetActorEnableCollision(bEnabled);
+
+	if (UCharacterMovementComponent* Movement = GetCharacterMovement())
+	{
+		if (bEnabled)
+		{
+			Movement->Activate(/*bReset=*/ true);
+			Movement->SetMovementMode(MOVE_Walking);
+		}
+		else
+		{
+			Movement->StopMovementImmediately();
+			Movement->Deactivate();
+		}
+	}
+
+	if (USkeletalMeshComponent* MeshComp = GetMesh())
+	{
+		// Take hidden meshes out of the budget so the allocator neither ticks them nor counts them.
+		USkeletalMeshComponentBudgeted* BudgetedMesh = Cast<USkeletalMeshComponentBudgeted>(MeshComp);
+		IAnimationBudgetAllocator* Allocator = BudgetedMesh ? IAnimationBudgetAllocator::Get(GetWorld()) : nullptr;
+		if (Allocator && !bEnabled)
+		{
+			Allocator->UnregisterComponent(BudgetedMesh);
+		}
+
+		MeshComp->SetComponentTickEnabled(bEnabled);
+
+		if (Allocator && bEnabled)
+		{
+			Allocator->RegisterComponent(BudgetedMesh);
+		}
+	}
+
+	if (MonsterAudioComponent)
+	{
+		MonsterAudioComponent->SetAudioSuspended(!bEnabled);
+	}
+}
+
+void AWendigoCharacter::SetDormant(bool bNewDormant)
+{
+	if (bDormant == bNewDormant)
+	{
+		return;
+	}
+
+	// A virtualised Wendigo is already suspended -- bring it back to a known state first.
+	if (bNewDormant && SimulationLODComponent)
+	{
+		SimulationLODComponent->ForceFullSimulation();
+	}
+
+	bDormant = bNewDormant;
+
+	if (SimulationLODComponent)
+	{
+		SimulationLODComponent->SetRelevanceChecksPaused(bNewDormant);
+	}
+
+	SetPawnSimulationEnabled(!bNewDormant);
+
+	if (AWendigoAIController* WendigoController = Cast<AWendigoAIController>(GetController()))
+	{
+		// Parked with the State Tree started and paused, so activation only unpauses it.
+		WendigoController->SetSimulationSuspended(bNewDormant, /*bPauseStateTree=*/ true);
+	}
+
+	UE_LOG(LogSerene, Log, TEXT("WendigoCharacter [%s]: %s"), *GetName(), bNewDormant ? TEXT("Dormant") : TEXT("Active"));
+}
+
+void AWendigoCharacter::ResetAIState()
+{
+	if (SuspicionComponent)
+	{
+		SuspicionComponent->ResetSuspicion();
+	}
+	ClearLastKnownPlayerLocation();
+	ClearWitnessedHidingSpot();
+	SetBehaviorState(EWendigoBehaviorState::Patrol);
+}
+
 void AWendigoCharacter::SetLastKnownPlayerLocation(const FVector& Location)
 {
 	LastKnownPlayerLocation = Location;
@@ -0,0 +1,170 @@
+// Copyright Null Lantern.
+
+#include "AI/WendigoChasePlanner.h"
+#include "AIController.h"
+#include "NavigationSystem.h"
+#include "NavigationData.h"
+#include "NavFilters/NavigationQueryFilter.h"
+
+FVector FWendigoChasePlanner::PredictInterceptPoint(const FVector& ChaserLocation, float ChaserSpeed,
+	const FVector& TargetLocation, const FVector& TargetVelocity, float MaxPredictionTime)
+{
+	const FVector Velocity(TargetVelocity.X, TargetVelocity.Y, 0.0);
+	if (Velocity.IsNearlyZero() || MaxPredictionTime <= 0.0f)
+	{
+		return TargetLocation;
+	}
+
+	// Solve |D + V*t| = S*t for the smallest t > 0, where D = Target - Chaser:
+	// (V.V - S^2) t^2 + 2 (D.V) t + D.D = 0
+	const FVector Offset(TargetLocation.X - ChaserLocation.X, TargetLocation.Y - ChaserLocation.Y, 0.0);
+	const double A = Velocity.SizeSquared() - FMath::Square(static_cast<double>(ChaserSpeed));
+	const double B = 2.0 * FVector::DotProduct(Offset, Velocity);
+	const double C = Offset.SizeSquared();
+
+	double Time = MaxPredictionTime;
+	if (FMath::Abs(A) < UE_KINDA_SMALL_NUMBER)
+	{
+		// Equal speeds: linear case
+		if (B < 0.0)
+		{
+			Time = -C / B;
+		}
+	}
+	else
+	{
+		const double Discriminant = B * B - 4.0 * A * C;
+		if (Discriminant >= 0.0)
+		{
+			const double Root = FMath::Sqrt(Discriminant);
+			const double T0 = (-B - Root) / (2.0 * A);
+			const double T1 = (-B + Root) / (2.0 * A);
+			const double Smallest = FMath::Min(T0, T1);
+			const double Largest = FMath::Max(T0, T1);
+			if (Smallest > 0.0)
+			{
+				Time = Smallest;
+			}
+			else if (Largest > 0.0)
+			{
+				Time = Largest;
+			}
+		}
+	}
+
+	Time = FMath::Clamp(Time, 0.0, static_cast<double>(MaxPredictionTime));
+	return TargetLocation + Velocity * Time;
+}
+
+void FWendigoChasePlanner::Reset()
+{
+	// Dropping our reference orphans any in-flight result; the callback holds only a weak pointer.
+	PendingResult.Reset();
+	bHasGoal = false;
+	LastRepathTime = -DBL_MAX;
+	NumQueries = 0;
+}
+
+void FWendigoChasePlanner::SetCurrentGoal(const FVector& Goal, double Now)
+{
+	CurrentGoal = Goal;
+	bHasGoal = true;
+	LastRepathTime = Now;
+	++NumQueries;
+}
+
+bool FWendigoChasePlanner::ShouldRepath(const FVector& NewGoal, double Now, float GoalTolerance,
+	float MinRepathInterval, bool bPathIdle) const
+{
+	if (IsQueryPending())
+	{
+		return false;
+	}
+
+	if (!bHasGoal)
+	{
+		return true;
+	}
+
+	if (Now - LastRepathTime < MinRepathInterval)
+	{
+		return false;
+	}
+
+	// Reuse the current corridor while the goal stays close to where it ends.
+	const bool bGoalDrifted = FVector::DistSquared(NewGoal, CurrentGoal) > FMath::Square(GoalTolerance);
+	return bGoalDrifted || bPathIdle;
+}
+
+bool FWendigoChasePlanner::RequestPathAsync(AAIController& Controller, const FVector& Goal, double Now)
+{
+	const APawn* Pawn = Controller.GetPawn();
+	UNavigationSystemV1* NavSys = Pawn ? FNavigationSystem::GetCurrent<UNavigationSystemV1>(Pawn->GetWorld()) : nullptr;
+	if (!NavSys)
+	{
+		return false;
+	}
+
+	const FNavAgentProperties& AgentProps = Pawn->GetNavAgentPropertiesRef();
+	const ANavigationData* NavData = NavSys->GetNavDataForProps(AgentProps, Pawn->GetNavAgentLocation());
+	if (!NavData)
+	{
+		return false;
+	}
+
+	FPathFindingQuery Query(&Controller, *NavData, Pawn->GetNavAgentLocation(), Goal,
+		UNavigationQueryFilter::GetQueryFilter(*NavData, &Controller, nullptr));
+	Query.SetAllowPartialPaths(true);
+
+	TSharedPtr<FAsyncResultSlot> Slot = MakeShared<FAsyncResultSlot>();
+	TWeakPtr<FAsyncResultSlot> WeakSlot = Slot;
+
+	const uint32 QueryId = NavSys->FindPathAsync(AgentProps, Query,
+		FNavPathQueryDelegate::CreateLambda(
+			[WeakSlot](uint32 InQueryId, ENavigationQueryResult::Type Result, FNavPathSharedPtr Path)
+			{
+				const TSharedPtr<FAsyncResultSlot> PinnedSlot = WeakSlot.Pin();
+				if (!PinnedSlot || PinnedSlot->QueryId != InQueryId)
+				{
+					return;
+				}
+
+				PinnedSlot->bComplete = true;
+				if (Result == ENavigationQueryResult::Success && Path.IsValid() && Path->IsValid())
+				{
+					PinnedSlot->Path = Path;
+				}
+			}),
+		EPathFindingMode::Regular);
+
+	if (QueryId == INVALID_NAVQUERYID)
+	{
+		return false;
+	}
+
+	Slot->QueryId = QueryId;
+	PendingResult = Slot;
+
+	CurrentGoal = Goal;
+	bHasGoal = true;
+	LastRepathTime = Now;
+	++NumQueries;
+	return true;
+}
+
+bool FWendigoChasePlanner::IsQueryPending() const
+{
+	return PendingResult.IsValid() && !PendingResult->bComplete;
+}
+
+bool FWendigoChasePlanner::ConsumeResult(FNavPathSharedPtr& OutPath)
+{
+	if (!PendingResult.IsValid() || !PendingResult->bComplete)
+	{
+		return false;
+	}
+
+	OutPath = MoveTemp(PendingResult->Path);
+	PendingResult.Reset();
+	return true;
+}
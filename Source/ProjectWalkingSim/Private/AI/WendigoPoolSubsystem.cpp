@@ -0,0 +1,127 @@
+// Copyright Null Lantern.
+
+#include "AI/WendigoPoolSubsystem.h"
+#include "AI/WendigoCharacter.h"
+#include "AI/PatrolRouteActor.h"
+#include "Core/SereneLogChannels.h"
+
+void UWendigoPoolSubsystem::Deinitialize()
+{
+	Buckets.Empty();
+
+	Super::Deinitialize();
+}
+
+bool UWendigoPoolSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+AWendigoCharacter* UWendigoPoolSubsystem::SpawnInstance(
+	TSubclassOf<AWendigoCharacter> WendigoClass, const FTransform& Transform) const
+{
+	UWorld* World = GetWorld();
+	if (!World || !WendigoClass)
+	{
+		return nullptr;
+	}
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+
+	// AutoPossessAI spawns and possesses the AIController inside SpawnActor,
+	// so the State Tree and perception are initialised by the time this returns.
+	return World->SpawnActor<AWendigoCharacter>(WendigoClass, Transform, SpawnParams);
+}
+
+void UWendigoPoolSubsystem::Prewarm(
+	TSubclassOf<AWendigoCharacter> WendigoClass, int32 Count, const FTransform& ParkTransform)
+{
+	if (!WendigoClass || Count <= 0)
+	{
+		return;
+	}
+
+	FWendigoPoolBucket& Bucket = Buckets.FindOrAdd(WendigoClass.Get());
+	Bucket.Dormant.Reserve(Bucket.Dormant.Num() + Count);
+
+	for (int32 i = 0; i < Count; ++i)
+	{
+		AWendigoCharacter* Wendigo = SpawnInstance(WendigoClass, ParkTransform);
+		if (!Wendigo)
+		{
+			UE_LOG(LogSerene, Warning, TEXT("WendigoPool: Prewarm spawn failed for %s"), *WendigoClass->GetName());
+			continue;
+		}
+
+		Wendigo->SetDormant(true);
+		Bucket.Dormant.Add(Wendigo);
+	}
+
+	UE_LOG(LogSerene, Log, TEXT("WendigoPool: Prewarmed %d x %s (%d dormant)"),
+		Count, *WendigoClass->GetName(), Bucket.Dormant.Num());
+}
+
+AWendigoCharacter* UWendigoPoolSubsystem::Acquire(TSubclassOf<AWendigoCharacter> WendigoClass,
+	const FVector& Location, const FRotator& Rotation, APatrolRouteActor* Route)
+{
+	if (!WendigoClass)
+	{
+		return nullptr;
+	}
+
+	AWendigoCharacter* Wendigo = nullptr;
+	if (FWendigoPoolBucket* Bucket = Buckets.Find(WendigoClass.Get()))
+	{
+		while (!Wendigo && Bucket->Dormant.Num() > 0)
+		{
+			// Pooled actors can still be destroyed externally (level streaming, debug commands).
+			AWendigoCharacter* Candidate = Bucket->Dormant.Pop(EAllowShrinking::No);
+			if (IsValid(Candidate))
+			{
+				Wendigo = Candidate;
+			}
+		}
+	}
+
+	if (!Wendigo)
+	{
+		UE_LOG(LogSerene, Warning, TEXT("WendigoPool: No dormant %s -- spawning at runtime (raise PoolSize)"),
+			*WendigoClass->GetName());
+
+		Wendigo = SpawnInstance(WendigoClass, FTransform(Rotation, Location));
+		if (Wendigo)
+		{
+			Wendigo->SetPatrolRoute(Route);
+		}
+		return Wendigo;
+	}
+
+	// Clear anything left over from a previous activation.
+	Wendigo->ResetAIState();
+
+	Wendigo->SetActorLocationAndRotation(Location, Rotation, /*bSweep=*/ false, nullptr, ETeleportType::TeleportPhysics);
+	Wendigo->SetPatrolRoute(Route);
+
+	// Last: unpauses the State Tree (parked at its root) with the route already assigned.
+	Wendigo->SetDormant(false);
+
+	return Wendigo;
+}
+
+void UWendigoPoolSubsystem::Release(AWendigoCharacter* Wendigo)
+{
+	if (!IsValid(Wendigo) || Wendigo->IsDormant())
+	{
+		return;
+	}
+
+	Wendigo->SetDormant(true);
+	Buckets.FindOrAdd(Wendigo->GetClass()).Dormant.Add(Wendigo);
+}
+
+int32 UWendigoPoolSubsystem::GetNumDormant(TSubclassOf<AWendigoCharacter> WendigoClass) const
+{
+	const FWendigoPoolBucket* Bucket = Buckets.Find(WendigoClass.Get());
+	return Bucket ? Bucket->Dormant.Num() : 0;
+}
@@ -0,0 +1,450 @@
+// Copyright Null Lantern.
+
+#include "AI/WendigoSimulationLODComponent.h"
+#include "AI/WendigoCharacter.h"
+#include "AI/WendigoAIController.h"
+#include "AI/SuspicionComponent.h"
+#include "Components/CapsuleComponent.h"
+#include "SkeletalMeshComponentBudgeted.h"
+#include "IAnimationBudgetAllocator.h"
+#include "AnimationBudgetAllocatorParameters.h"
+#include "Engine/Engine.h"
+#include "HAL/IConsoleManager.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "NavigationSystem.h"
+#include "NavigationPath.h"
+#include "Kismet/GameplayStatics.h"
+#include "Core/SereneLogChannels.h"
+
+namespace
+{
+	/** Guards AdvanceVirtual against degenerate routes (zero-length legs, zero idle). */
+	constexpr int32 MaxVirtualStepsPerUpdate = 32;
+
+	/** Push Serene.Anim.BudgetMs into the world's animation budget allocator. <= 0 disables it (URO fallback). */
+	void ApplyAnimationBudget(UWorld* World, float BudgetMs)
+	{
+		IAnimationBudgetAllocator* Allocator = World ? IAnimationBudgetAllocator::Get(World) : nullptr;
+		if (!Allocator)
+		{
+			return;
+		}
+
+		Allocator->SetEnabled(BudgetMs > 0.0f);
+		if (BudgetMs > 0.0f)
+		{
+			// Only the budget is ours; the rest (a.Budget.* CVars, project setup) is left as configured.
+			FAnimationBudgetAllocatorParameters Parameters = Allocator->GetParameters();
+			Parameters.BudgetInMs = BudgetMs;
+			Allocator->SetParameters(Parameters);
+		}
+	}
+
+	void OnAnimBudgetChanged(IConsoleVariable* Var)
+	{
+		if (!GEngine)
+		{
+			return;
+		}
+
+		for (const FWorldContext& Context : GEngine->GetWorldContexts())
+		{
+			if (Context.WorldType == EWorldType::Game || Context.WorldType == EWorldType::PIE)
+			{
+				ApplyAnimationBudget(Context.World(), Var->GetFloat());
+			}
+		}
+	}
+
+	TAutoConsoleVariable<float> CVarAnimBudgetMs(
+		TEXT("Serene.Anim.BudgetMs"),
+		1.0f,
+		TEXT("Total game-thread ms per frame for budgeted Wendigo animation (0 = allocator off, URO only)."),
+		FConsoleVariableDelegate::CreateStatic(&OnAnimBudgetChanged),
+		ECVF_Default);
+}
+
+UWendigoSimulationLODComponent::UWendigoSimulationLODComponent()
+{
+	PrimaryComponentTick.bCanEverTick = false;
+}
+
+void UWendigoSimulationLODComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	UWorld* World = GetWorld();
+	AWendigoCharacter* Wendigo = Cast<AWendigoCharacter>(GetOwner());
+	if (!World || !Wendigo)
+	{
+		return;
+	}
+
+	// Random first delay staggers checks across Wendigos spawned on the same frame.
+	World->GetTimerManager().SetTimer(
+		RelevanceTimerHandle,
+		this,
+		&UWendigoSimulationLODComponent::EvaluateRelevance,
+		RelevanceCheckInterval,
+		/*bLoop=*/ true,
+		FMath::FRandRange(0.0f, RelevanceCheckInterval));
+
+	// Allocator parameters are per world; re-applying for each Wendigo is harmless.
+	ApplyAnimationBudget(World, CVarAnimBudgetMs.GetValueOnGameThread());
+
+	Wendigo->OnBehaviorStateChanged.AddDynamic(
+		this, &UWendigoSimulationLODComponent::HandleBehaviorStateChanged);
+
+	// Pooled Wendigos can be made dormant before BeginPlay runs.
+	if (Wendigo->IsDormant())
+	{
+		World->GetTimerManager().PauseTimer(RelevanceTimerHandle);
+
+		// The budgeted mesh auto-registered in its own BeginPlay.
+		USkeletalMeshComponentBudgeted* BudgetedMesh = Cast<USkeletalMeshComponentBudgeted>(Wendigo->GetMesh());
+		if (IAnimationBudgetAllocator* Allocator = BudgetedMesh ? IAnimationBudgetAllocator::Get(World) : nullptr)
+		{
+			Allocator->UnregisterComponent(BudgetedMesh);
+		}
+	}
+}
+
+void UWendigoSimulationLODComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (const UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(RelevanceTimerHandle);
+	}
+
+	if (AWendigoCharacter* Wendigo = Cast<AWendigoCharacter>(GetOwner()))
+	{
+		Wendigo->OnBehaviorStateChanged.RemoveDynamic(this, &UWendigoSimulationLODComponent::HandleBehaviorStateChanged);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void UWendigoSimulationLODComponent::ForceFullSimulation()
+{
+	AWendigoCharacter* Wendigo = Cast<AWendigoCharacter>(GetOwner());
+	if (Wendigo && IsVirtualized())
+	{
+		if (const UWorld* World = GetWorld())
+		{
+			AdvanceVirtual(Wendigo, static_cast<float>(World->GetTimeSeconds() - LastVirtualUpdateTime));
+		}
+		ExitVirtual(Wendigo);
+	}
+}
+
+void UWendigoSimulationLODComponent::SetRelevanceChecksPaused(bool bPaused)
+{
+	UWorld* World = GetWorld();
+	if (!World || !RelevanceTimerHandle.IsValid())
+	{
+		return;
+	}
+
+	if (bPaused)
+	{
+		World->GetTimerManager().PauseTimer(RelevanceTimerHandle);
+	}
+	else
+	{
+		World->GetTimerManager().UnPauseTimer(RelevanceTimerHandle);
+	}
+}
+
+// ---------------------------------------------------------------------------
+// Relevance
+// ---------------------------------------------------------------------------
+
+void UWendigoSimulationLODComponent::EvaluateRelevance()
+{
+	AWendigoCharacter* Wendigo = Cast<AWendigoCharacter>(GetOwner());
+	UWorld* World = GetWorld();
+	if (!Wendigo || !World)
+	{
+		return;
+	}
+
+	const APawn* PlayerPawn = UGameplayStatics::GetPlayerPawn(World, 0);
+	if (!PlayerPawn)
+	{
+		return;
+	}
+
+	if (IsVirtualized())
+	{
+		const double Now = World->GetTimeSeconds();
+		AdvanceVirtual(Wendigo, static_cast<float>(Now - LastVirtualUpdateTime));
+		LastVirtualUpdateTime = Now;
+
+		const float ExitRadius = FMath::Max(0.0f, VirtualizationRadius - VirtualizationHysteresis);
+		if (!bAllowVirtualization
+			|| FVector::DistSquared(Wendigo->GetActorLocation(), PlayerPawn->GetActorLocation()) < FMath::Square(ExitRadius))
+		{
+			ExitVirtual(Wendigo);
+		}
+		return;
+	}
+
+	if (CanVirtualize(Wendigo)
+		&& FVector::DistSquared(Wendigo->GetActorLocation(), PlayerPawn->GetActorLocation()) > FMath::Square(VirtualizationRadius))
+	{
+		EnterVirtual(Wendigo);
+		return;
+	}
+
+	UpdateSignificance(Wendigo, PlayerPawn);
+}
+
+// ---------------------------------------------------------------------------
+// Animation Significance
+// ---------------------------------------------------------------------------
+
+void UWendigoSimulationLODComponent::HandleBehaviorStateChanged(EWendigoBehaviorState NewState)
+{
+	AWendigoCharacter* Wendigo = Cast<AWendigoCharacter>(GetOwner());
+	const APawn* PlayerPawn = UGameplayStatics::GetPlayerPawn(GetWorld(), 0);
+	if (Wendigo && PlayerPawn && !IsVirtualized() && !Wendigo->IsDormant())
+	{
+		UpdateSignificance(Wendigo, PlayerPawn);
+	}
+}
+
+void UWendigoSimulationLODComponent::UpdateSignificance(AWendigoCharacter* Wendigo, const APawn* PlayerPawn)
+{
+	EWendigoSignificanceTier NewTier = EWendigoSignificanceTier::OffScreen;
+	if (Wendigo->BehaviorState == EWendigoBehaviorState::Chasing
+		|| Wendigo->BehaviorState == EWendigoBehaviorState::GrabAttack)
+	{
+		NewTier = EWendigoSignificanceTier::Critical;
+	}
+	else if (Wendigo->WasRecentlyRendered(0.2f))
+	{
+		const bool bNear = FVector::DistSquared(Wendigo->GetActorLocation(), PlayerPawn->GetActorLocation())
+			< FMath::Square(NearSignificanceDistance);
+		NewTier = bNear ? EWendigoSignificanceTier::Near : EWendigoSignificanceTier::Far;
+	}
+
+	USkeletalMeshComponentBudgeted* BudgetedMesh = Cast<USkeletalMeshComponentBudgeted>(Wendigo->GetMesh());
+	if (!BudgetedMesh)
+	{
+		SignificanceTier = NewTier;
+		return;
+	}
+
+	// Re-send every check: the allocator may have reset significance on (re)registration.
+	switch (NewTier)
+	{
+	case EWendigoSignificanceTier::Critical:
+		// Grab and chase animation drive gameplay-visible contact -- never skip, even behind the camera.
+		BudgetedMesh->SetComponentSignificance(1.0f, /*bNeverSkip=*/ true, /*bTickEvenIfNotRendered=*/ true,
+			/*bAllowReducedWork=*/ false);
+		break;
+	case EWendigoSignificanceTier::Near:
+		BudgetedMesh->SetComponentSignificance(1.0f);
+		break;
+	case EWendigoSignificanceTier::Far:
+		BudgetedMesh->SetComponentSignificance(0.4f, /*bNeverSkip=*/ false, /*bTickEvenIfNotRendered=*/ false,
+			/*bAllowReducedWork=*/ true, /*bForceInterpolate=*/ true);
+		break;
+	case EWendigoSignificanceTier::OffScreen:
+		BudgetedMesh->SetComponentSignificance(0.1f);
+		break;
+	}
+
+	if (NewTier != SignificanceTier)
+	{
+		UE_LOG(LogSerene, Verbose, TEXT("WendigoSimulationLOD [%s]: Significance tier %d -> %d"),
+			*Wendigo->GetName(), static_cast<uint8>(SignificanceTier), static_cast<uint8>(NewTier));
+		SignificanceTier = NewTier;
+	}
+}
+
+bool UWendigoSimulationLODComponent::CanVirtualize(const AWendigoCharacter* Wendigo) const
+{
+	if (!bAllowVirtualization || Wendigo->BehaviorState != EWendigoBehaviorState::Patrol)
+	{
+		return false;
+	}
+
+	// Any suspicion means the State Tree may be about to leave Patrol -- keep full simulation.
+	const USuspicionComponent* Suspicion = Wendigo->GetSuspicionComponent();
+	if (Suspicion && Suspicion->GetAlertLevel() != EAlertLevel::Patrol)
+	{
+		return false;
+	}
+
+	const APatrolRouteActor* Route = Wendigo->GetPatrolRoute();
+	if (!Route || Route->GetNumWaypoints() < 2)
+	{
+		return false;
+	}
+
+	if (Wendigo->IsDormant() || !Cast<AWendigoAIController>(Wendigo->GetController()))
+	{
+		return false;
+	}
+
+	// Never pop out of view, even at long range (large open areas, scripted cameras).
+	return !Wendigo->WasRecentlyRendered(0.5f);
+}
+
+// ---------------------------------------------------------------------------
+// LOD Transitions
+// ---------------------------------------------------------------------------
+
+void UWendigoSimulationLODComponent::EnterVirtual(AWendigoCharacter* Wendigo)
+{
+	APatrolRouteActor* Route = Wendigo->GetPatrolRoute();
+	UWorld* World = GetWorld();
+
+	// Built once per route; later Wendigos sharing the route reuse the cached legs.
+	Route->BuildPatrolGraph(Wendigo);
+
+	// Entry leg: from wherever the pawn stands now to the waypoint it was heading for.
+	const FVector Start = Wendigo->GetActorLocation()
+		- FVector(0.0, 0.0, Wendigo->GetCapsuleComponent()->GetScaledCapsuleHalfHeight());
+	const FVector Target = Route->GetWaypoint(Wendigo->CurrentWaypointIndex);
+
+	TArray<FVector> EntryPoints;
+	if (UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(World))
+	{
+		const UNavigationPath* Path = NavSys->FindPathToLocationSynchronously(World, Start, Target, Wendigo);
+		if (Path && Path->IsValid() && Path->PathPoints.Num() >= 2)
+		{
+			EntryPoints = Path->PathPoints;
+		}
+	}
+	if (EntryPoints.Num() < 2)
+	{
+		EntryPoints = { Start, Target };
+	}
+	EntryLeg.Build(MoveTemp(EntryPoints));
+
+	VirtualFromIndex = INDEX_NONE;
+	VirtualLegDistance = 0.0f;
+	VirtualIdleRemaining = 0.0f;
+	LastVirtualUpdateTime = World->GetTimeSeconds();
+
+	if (AWendigoAIController* WendigoController = Cast<AWendigoAIController>(Wendigo->GetController()))
+	{
+		WendigoController->SetSimulationSuspended(true);
+	}
+	Wendigo->SetPawnSimulationEnabled(false);
+
+	SimulationLOD = EWendigoSimulationLOD::Virtual;
+
+	UE_LOG(LogSerene, Log, TEXT("WendigoSimulationLOD [%s]: Virtualised (heading to waypoint %d)"),
+		*Wendigo->GetName(), Wendigo->CurrentWaypointIndex);
+}
+
+void UWendigoSimulationLODComponent::ExitVirtual(AWendigoCharacter* Wendigo)
+{
+	SimulationLOD = EWendigoSimulationLOD::Full;
+	EntryLeg = FPatrolPolyline();
+
+	Wendigo->SetPawnSimulationEnabled(true);
+
+	// Restarts the State Tree at Patrol, which moves on to CurrentWaypointIndex.
+	if (AWendigoAIController* WendigoController = Cast<AWendigoAIController>(Wendigo->GetController()))
+	{
+		WendigoController->SetSimulationSuspended(false);
+	}
+
+	if (const APawn* PlayerPawn = UGameplayStatics::GetPlayerPawn(GetWorld(), 0))
+	{
+		UpdateSignificance(Wendigo, PlayerPawn);
+	}
+
+	UE_LOG(LogSerene, Log, TEXT("WendigoSimulationLOD [%s]: Restored at %s (heading to waypoint %d)"),
+		*Wendigo->GetName(), *Wendigo->GetActorLocation().ToString(), Wendigo->CurrentWaypointIndex);
+}
+
+// ---------------------------------------------------------------------------
+// Virtual Patrol
+// ---------------------------------------------------------------------------
+
+const FPatrolPolyline* UWendigoSimulationLODComponent::GetCurrentLeg(
+	const AWendigoCharacter* Wendigo, bool& bOutReverse) const
+{
+	bOutReverse = false;
+	if (VirtualFromIndex == INDEX_NONE)
+	{
+		return &EntryLeg;
+	}
+
+	const APatrolRouteActor* Route = Wendigo->GetPatrolRoute();
+	return Route ? Route->FindLeg(VirtualFromIndex, Wendigo->CurrentWaypointIndex, bOutReverse) : nullptr;
+}
+
+void UWendigoSimulationLODComponent::AdvanceVirtual(AWendigoCharacter* Wendigo, float DeltaSeconds)
+{
+	APatrolRouteActor* Route = Wendigo->GetPatrolRoute();
+	if (!Route || DeltaSeconds <= 0.0f)
+	{
+		return;
+	}
+
+	const UCharacterMovementComponent* Movement = Wendigo->GetCharacterMovement();
+	const float Speed = FMath::Max(1.0f, Movement ? Movement->MaxWalkSpeed : AIConstants::WendigoWalkSpeed);
+
+	float RemainingTime = DeltaSeconds;
+	for (int32 Step = 0; Step < MaxVirtualStepsPerUpdate && RemainingTime > 0.0f; ++Step)
+	{
+		if (VirtualIdleRemaining > 0.0f)
+		{
+			const float IdleTime = FMath::Min(VirtualIdleRemaining, RemainingTime);
+			VirtualIdleRemaining -= IdleTime;
+			RemainingTime -= IdleTime;
+			continue;
+		}
+
+		bool bReverse = false;
+		const FPatrolPolyline* Leg = GetCurrentLeg(Wendigo, bReverse);
+		if (!Leg)
+		{
+			// Route changed under us (non-adjacent indices) -- walk straight to the target.
+			const FVector From = Route->GetWaypoint(VirtualFromIndex);
+			EntryLeg.Build(TArray<FVector>{ From, Route->GetWaypoint(Wendigo->CurrentWaypointIndex) });
+			VirtualFromIndex = INDEX_NONE;
+			Leg = &EntryLeg;
+		}
+
+		const float LegRemaining = Leg->GetLength() - VirtualLegDistance;
+		const float Travel = Speed * RemainingTime;
+		if (Travel < LegRemaining)
+		{
+			VirtualLegDistance += Travel;
+			RemainingTime = 0.0f;
+			break;
+		}
+
+		// Reached the waypoint: advance exactly as STT_PatrolMoveToWaypoint does, then idle.
+		RemainingTime -= LegRemaining / Speed;
+		VirtualFromIndex = Wendigo->CurrentWaypointIndex;
+		Wendigo->CurrentWaypointIndex = Route->GetNextWaypointIndex(VirtualFromIndex);
+		VirtualLegDistance = 0.0f;
+		VirtualIdleRemaining = VirtualIdleDuration;
+	}
+
+	bool bReverse = false;
+	const FPatrolPolyline* Leg = GetCurrentLeg(Wendigo, bReverse);
+	if (!Leg || Leg->Points.Num() == 0)
+	{
+		return;
+	}
+
+	FVector Direction = Wendigo->GetActorForwardVector();
+	const FVector GroundPoint = Leg->Sample(VirtualLegDistance, bReverse, &Direction);
+	const FVector NewLocation = GroundPoint
+		+ FVector(0.0, 0.0, Wendigo->GetCapsuleComponent()->GetScaledCapsuleHalfHeight());
+
+	const FRotator NewRotation = Direction.IsNearlyZero()
+		? Wendigo->GetActorRotation()
+		: FRotator(0.0, Direction.Rotation().Yaw, 0.0);
+
+	Wendigo->SetActorLocationAndRotation(NewLocation, NewRotation, /*bSweep=*/ false, nullptr, ETeleportType::TeleportPhysics);
+}
@@ -3,6 +3,7 @@
 #include "AI/WendigoSpawnPoint.h"
 #include "AI/WendigoCharacter.h"
 #include "AI/PatrolRouteActor.h"
+#include "AI/WendigoPoolSubsystem.h"
 #include "Core/SereneLogChannels.h"
 #include "Components/BillboardComponent.h"
 
@@ -20,6 +21,22 @@ AWendigoSpawnPoint::AWendigoSpawnPoint()
 #endif
 }
 
+void AWendigoSpawnPoint::BeginPlay()
+{
+	Super::BeginPlay();
+
+	if (!WendigoClass || PoolSize <= 0)
+	{
+		return;
+	}
+
+	// Pay construction, possession and State Tree/perception setup during level load.
+	if (UWendigoPoolSubsystem* Pool = GetWorld()->GetSubsystem<UWendigoPoolSubsystem>())
+	{
+		Pool->Prewarm(WendigoClass, PoolSize, GetActorTransform());
+	}
+}
+
 AWendigoCharacter* AWendigoSpawnPoint::SpawnWendigo()
 {
 	if (!WendigoClass)
@@ -36,11 +53,32 @@ AWendigoCharacter* AWendigoSpawnPoint::SpawnWendigo()
 		return nullptr;
 	}
 
-	FActorSpawnParameters SpawnParams;
-	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+	// Pick the route up front so the pooled Wendigo restarts its State Tree with it assigned
+	APatrolRouteActor* SelectedRoute = nullptr;
+	int32 RouteIndex = INDEX_NONE;
+	if (AvailablePatrolRoutes.Num() > 0)
+	{
+		RouteIndex = FMath::RandRange(0, AvailablePatrolRoutes.Num() - 1);
+		SelectedRoute = AvailablePatrolRoutes[RouteIndex];
+	}
+
+	AWendigoCharacter* SpawnedWendigo = nullptr;
+	if (UWendigoPoolSubsystem* Pool = World->GetSubsystem<UWendigoPoolSubsystem>())
+	{
+		SpawnedWendigo = Pool->Acquire(WendigoClass, GetActorLocation(), GetActorRotation(), SelectedRoute);
+	}
+	else
+	{
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
 
-	AWendigoCharacter* SpawnedWendigo = World->SpawnActor<AWendigoCharacter>(
-		WendigoClass, GetActorLocation(), GetActorRotation(), SpawnParams);
+		SpawnedWendigo = World->SpawnActor<AWendigoCharacter>(
+			WendigoClass, GetActorLocation(), GetActorRotation(), SpawnParams);
+		if (SpawnedWendigo && SelectedRoute)
+		{
+			SpawnedWendigo->SetPatrolRoute(SelectedRoute);
+		}
+	}
 
 	if (!SpawnedWendigo)
 	{
@@ -48,26 +86,17 @@ AWendigoCharacter* AWendigoSpawnPoint::SpawnWendigo()
 		return nullptr;
 	}
 
-	// Assign a random patrol route from available routes
-	if (AvailablePatrolRoutes.Num() > 0)
+	if (SelectedRoute)
 	{
-		const int32 RouteIndex = FMath::RandRange(0, AvailablePatrolRoutes.Num() - 1);
-		APatrolRouteActor* SelectedRoute = AvailablePatrolRoutes[RouteIndex];
-
-		if (SelectedRoute)
-		{
-			SpawnedWendigo->SetPatrolRoute(SelectedRoute);
-
-			UE_LOG(LogSerene, Log, TEXT("AWendigoSpawnPoint [%s]: Spawned Wendigo at %s with patrol route %s"),
-				*GetName(),
-				*GetActorLocation().ToString(),
-				*SelectedRoute->GetName());
-		}
-		else
-		{
-			UE_LOG(LogSerene, Warning, TEXT("AWendigoSpawnPoint [%s]: Selected patrol route at index %d is null."),
-				*GetName(), RouteIndex);
-		}
+		UE_LOG(LogSerene, Log, TEXT("AWendigoSpawnPoint [%s]: Spawned Wendigo at %s with patrol route %s"),
+			*GetName(),
+			*GetActorLocation().ToString(),
+			*SelectedRoute->GetName());
+	}
+	else if (RouteIndex != INDEX_NONE)
+	{
+		UE_LOG(LogSerene, Warning, TEXT("AWendigoSpawnPoint [%s]: Selected patrol route at index %d is null."),
+			*GetName(), RouteIndex);
 	}
 	else
 	{
@@ -48,9 +48,12 @@ void UMonsterAudioComponent::BeginPlay()
 		BreathingAudioComp->RegisterComponent();
 	}
 
-	// Start with Patrol breathing and footstep timer.
-	TransitionBreathingSound(EWendigoBehaviorState::Patrol);
-	UpdateFootstepTimer();
+	// Start with Patrol breathing and footstep timer (unless the owner was parked before BeginPlay).
+	if (!bAudioSuspended)
+	{
+		TransitionBreathingSound(EWendigoBehaviorState::Patrol);
+		UpdateFootstepTimer();
+	}
 }
 
 void UMonsterAudioComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
@@ -79,10 +82,42 @@ void UMonsterAudioComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 	Super::EndPlay(EndPlayReason);
 }
 
+void UMonsterAudioComponent::SetAudioSuspended(bool bSuspended)
+{
+	if (bAudioSuspended == bSuspended)
+	{
+		return;
+	}
+	bAudioSuspended = bSuspended;
+
+	if (bSuspended)
+	{
+		if (const UWorld* World = GetWorld())
+		{
+			World->GetTimerManager().ClearTimer(FootstepTimerHandle);
+		}
+		if (BreathingAudioComp)
+		{
+			BreathingAudioComp->Stop();
+		}
+		return;
+	}
+
+	// Resume with the sounds for whatever state the owner is in now.
+	const AWendigoCharacter* Wendigo = Cast<AWendigoCharacter>(GetOwner());
+	TransitionBreathingSound(Wendigo ? Wendigo->BehaviorState : EWendigoBehaviorState::Patrol);
+	UpdateFootstepTimer();
+}
+
 // --- Delegate Handler ---
 
 void UMonsterAudioComponent::OnBehaviorStateChanged(EWendigoBehaviorState NewState)
 {
+	if (bAudioSuspended)
+	{
+		return;
+	}
+
 	TransitionBreathingSound(NewState);
 	PlayVocalization(NewState);
 	UpdateFootstepTimer();
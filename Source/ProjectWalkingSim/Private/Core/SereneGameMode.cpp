@@ -36,13 +36,24 @@ void ASereneGameMode::InitGame(const FString& MapName, const FString& Options, F
 	}
 }
 
+void ASereneGameMode::BeginPlay()
+{
+	Super::BeginPlay();
+
+	if (USaveSubsystem* SaveSub = GetGameInstance()->GetSubsystem<USaveSubsystem>())
+	{
+		SaveSub->StartCheckpointTimer(GetWorld());
+	}
+}
+
 void ASereneGameMode::OnActorsReady(const FActorsInitializedParams& Params)
 {
 	USaveSubsystem* SaveSub = GetGameInstance()->GetSubsystem<USaveSubsystem>();
 	if (SaveSub)
 	{
-		SaveSub->ApplyPendingSaveData(GetWorld());
-		UE_LOG(LogSerene, Log, TEXT("SereneGameMode::OnActorsReady - Pending save data applied"));
+		// Applies now, or as soon as the background save load finishes.
+		SaveSub->ApplyPendingSaveDataWhenReady(GetWorld());
+		UE_LOG(LogSerene, Log, TEXT("SereneGameMode::OnActorsReady - Pending save data handed to SaveSubsystem"));
 	}
 }
 
@@ -77,3 +88,23 @@ void ASereneGameMode::OnPlayerDeath()
 		UE_LOG(LogSerene, Warning, TEXT("SereneGameMode::OnPlayerDeath - GameOverWidgetClass not set, cannot show Game Over screen"));
 	}
 }
+
+void ASereneGameMode::ClearGameOver()
+{
+	if (!GameOverWidgetInstance)
+	{
+		return;
+	}
+
+	GameOverWidgetInstance->RemoveFromParent();
+	GameOverWidgetInstance = nullptr;
+
+	if (APlayerController* PC = UGameplayStatics::GetPlayerController(GetWorld(), 0))
+	{
+		PC->SetShowMouseCursor(false);
+		FInputModeGameOnly InputMode;
+		PC->SetInputMode(InputMode);
+	}
+
+	UE_LOG(LogSerene, Log, TEXT("SereneGameMode::ClearGameOver - Game Over widget removed"));
+}
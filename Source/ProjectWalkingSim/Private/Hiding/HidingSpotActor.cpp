@@ -5,6 +5,7 @@
 #include "Camera/CameraComponent.h"
 #include "Components/StaticMeshComponent.h"
 #include "Core/SereneLogChannels.h"
+#include "AI/HidingSpotIndexSubsystem.h"
 
 #include "Hiding/HidingComponent.h"
 
@@ -51,6 +52,22 @@ void AHidingSpotActor::BeginPlay()
 	{
 		UE_LOG(LogSerene, Warning, TEXT("HidingSpot [%s] has no SpotData assigned"), *GetName());
 	}
+
+	// Make this spot known to AI search
+	if (UHidingSpotIndexSubsystem* Index = GetWorld()->GetSubsystem<UHidingSpotIndexSubsystem>())
+	{
+		Index->RegisterSpot(this);
+	}
+}
+
+void AHidingSpotActor::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UHidingSpotIndexSubsystem* Index = GetWorld()->GetSubsystem<UHidingSpotIndexSubsystem>())
+	{
+		Index->UnregisterSpot(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
 }
 
 // =============================================================================
@@ -2,6 +2,7 @@
 
 #include "Interaction/DoorActor.h"
 
+#include "AI/OpenableNavModifierComponent.h"
 #include "Inventory/InventoryComponent.h"
 #include "Save/SereneSaveGame.h"
 #include "Tags/SereneTags.h"
@@ -15,12 +16,23 @@ ADoorActor::ADoorActor()
 	// Door panel mesh, child of root frame
 	DoorMesh = CreateDefaultSubobject<UStaticMeshComponent>(TEXT("DoorMesh"));
 	DoorMesh->SetupAttachment(MeshComponent);
+	DoorMesh->SetCanEverAffectNavigation(false);
+
+	// Doorway nav area follows bIsOpen (bounds taken from the frame)
+	NavModifier = CreateDefaultSubobject<UOpenableNavModifierComponent>(TEXT("NavModifier"));
 
 	InteractionText = NSLOCTEXT("Interaction", "DoorOpen", "Open");
 	InteractionTag = SereneTags::TAG_Interaction_Door;
 	LockedText = NSLOCTEXT("Interaction", "DoorLocked", "Locked");
 }
 
+void ADoorActor::BeginPlay()
+{
+	Super::BeginPlay();
+
+	bLockedAtLevelStart = bIsLocked;
+}
+
 bool ADoorActor::CanInteract_Implementation(AActor* Interactor) const
 {
 	// Check base enable flag
@@ -106,7 +118,13 @@ void ADoorActor::OnInteract_Implementation(AActor* Interactor)
 		UE_LOG(LogSerene, Verbose, TEXT("ADoorActor::OnInteract - Door closing."));
 	}
 
+	if (NavModifier)
+	{
+		NavModifier->SetOpenState(bIsOpen);
+	}
+
 	SetActorTickEnabled(true);
+	MarkSaveDirty();
 }
 
 void ADoorActor::OpenForAI(AActor* AIActor)
@@ -135,11 +153,30 @@ void ADoorActor::OpenForAI(AActor* AIActor)
 
 	TargetAngle = OpenAngle * OpenDirection;
 	SetActorTickEnabled(true);
+	MarkSaveDirty();
+
+	if (NavModifier)
+	{
+		NavModifier->SetOpenState(true);
+	}
 
 	UE_LOG(LogSerene, Log, TEXT("ADoorActor [%s]: Opened for AI. Direction=%.0f, TargetAngle=%.1f"),
 		*GetName(), OpenDirection, TargetAngle);
 }
 
+void ADoorActor::SetLocked(bool bNewLocked)
+{
+	if (bIsLocked == bNewLocked)
+	{
+		return;
+	}
+
+	bIsLocked = bNewLocked;
+	MarkSaveDirty();
+
+	UE_LOG(LogSerene, Log, TEXT("ADoorActor [%s]: %s"), *GetName(), bIsLocked ? TEXT("Locked") : TEXT("Unlocked"));
+}
+
 void ADoorActor::Tick(float DeltaTime)
 {
 	Super::Tick(DeltaTime);
@@ -164,6 +201,9 @@ void ADoorActor::Tick(float DeltaTime)
 		CurrentAngle = TargetAngle;
 		DoorMesh->SetRelativeRotation(FRotator(0.0f, CurrentAngle, 0.0f));
 		SetActorTickEnabled(false);
+
+		// Saved mid-swing: the settled angle replaces the one written then
+		MarkSaveDirty();
 	}
 }
 
@@ -183,6 +223,12 @@ void ADoorActor::WriteSaveData_Implementation(USereneSaveGame* SaveGame)
 		return;
 	}
 
+	// Closed at rest with the level's lock state: the reloaded level already matches.
+	if (!bIsOpen && FMath::IsNearlyZero(CurrentAngle) && bIsLocked == bLockedAtLevelStart)
+	{
+		return;
+	}
+
 	FSavedDoorState State;
 	State.DoorId = GetFName();
 	State.bIsOpen = bIsOpen;
@@ -201,30 +247,53 @@ void ADoorActor::ReadSaveData_Implementation(USereneSaveGame* SaveGame)
 	}
 
 	const FName MyId = GetFName();
-	for (const FSavedDoorState& State : SaveGame->DoorStates)
+	const FSavedDoorState* State = SaveGame->FindDoorState(MyId);
+	if (!State)
 	{
-		if (State.DoorId == MyId)
-		{
-			bIsOpen = State.bIsOpen;
-			bIsLocked = State.bIsLocked;
-			CurrentAngle = State.CurrentAngle;
-			OpenDirection = State.OpenDirection;
-			TargetAngle = bIsOpen ? (OpenAngle * OpenDirection) : 0.0f;
-
-			// Snap door mesh to saved rotation (no interpolation on load)
-			if (DoorMesh)
-			{
-				DoorMesh->SetRelativeRotation(FRotator(0.0f, CurrentAngle, 0.0f));
-			}
-
-			// Update interaction text to match state
-			InteractionText = bIsOpen
-				? NSLOCTEXT("Interaction", "DoorClose", "Close")
-				: NSLOCTEXT("Interaction", "DoorOpen", "Open");
-
-			UE_LOG(LogSerene, Verbose, TEXT("ADoorActor [%s]: Restored from save (open=%d, locked=%d, angle=%.1f)"),
-				*MyId.ToString(), bIsOpen, bIsLocked, CurrentAngle);
-			return;
-		}
+		return;
+	}
+
+	bIsOpen = State->bIsOpen;
+	bIsLocked = State->bIsLocked;
+	CurrentAngle = State->CurrentAngle;
+	OpenDirection = State->OpenDirection;
+	TargetAngle = bIsOpen ? (OpenAngle * OpenDirection) : 0.0f;
+
+	// Snap to saved rotation (no interpolation on load)
+	ApplyStateImmediate();
+
+	UE_LOG(LogSerene, Verbose, TEXT("ADoorActor [%s]: Restored from save (open=%d, locked=%d, angle=%.1f)"),
+		*MyId.ToString(), bIsOpen, bIsLocked, CurrentAngle);
+}
+
+void ADoorActor::ResetToLevelDefault_Implementation()
+{
+	bIsOpen = false;
+	bIsLocked = bLockedAtLevelStart;
+	CurrentAngle = 0.0f;
+	TargetAngle = 0.0f;
+	OpenDirection = 1.0f;
+
+	ApplyStateImmediate();
+}
+
+void ADoorActor::ApplyStateImmediate()
+{
+	if (DoorMesh)
+	{
+		DoorMesh->SetRelativeRotation(FRotator(0.0f, CurrentAngle, 0.0f));
+	}
+
+	// Resume the swing only if restored mid-animation
+	SetActorTickEnabled(!FMath::IsNearlyEqual(CurrentAngle, TargetAngle, 0.1f));
+
+	// Update interaction text to match state
+	InteractionText = bIsOpen
+		? NSLOCTEXT("Interaction", "DoorClose", "Close")
+		: NSLOCTEXT("Interaction", "DoorOpen", "Open");
+
+	if (NavModifier)
+	{
+		NavModifier->SetOpenState(bIsOpen);
 	}
 }
@@ -2,9 +2,12 @@
 
 #include "Interaction/DrawerActor.h"
 
+#include "AI/OpenableNavModifierComponent.h"
 #include "Save/SereneSaveGame.h"
 #include "Tags/SereneTags.h"
 #include "Core/SereneLogChannels.h"
+#include "NavAreas/NavArea_Default.h"
+#include "NavAreas/NavArea_Obstacle.h"
 
 ADrawerActor::ADrawerActor()
 {
@@ -14,11 +17,29 @@ ADrawerActor::ADrawerActor()
 	// Drawer mesh, child of root frame
 	DrawerMesh = CreateDefaultSubobject<UStaticMeshComponent>(TEXT("DrawerMesh"));
 	DrawerMesh->SetupAttachment(MeshComponent);
+	DrawerMesh->SetCanEverAffectNavigation(false);
+
+	// Open drawer = obstacle, closed = no change to the baked navmesh
+	NavModifier = CreateDefaultSubobject<UOpenableNavModifierComponent>(TEXT("NavModifier"));
+	NavModifier->OpenAreaClass = UNavArea_Obstacle::StaticClass();
+	NavModifier->ClosedAreaClass = UNavArea_Default::StaticClass();
+	NavModifier->SetCanEverAffectNavigation(false);
 
 	InteractionText = NSLOCTEXT("Interaction", "DrawerOpen", "Open");
 	InteractionTag = SereneTags::TAG_Interaction_Drawer;
 }
 
+void ADrawerActor::OnConstruction(const FTransform& Transform)
+{
+	Super::OnConstruction(Transform);
+
+	// Per-instance opt-in; most drawers are too small to matter to the Wendigo
+	if (NavModifier)
+	{
+		NavModifier->SetCanEverAffectNavigation(bAffectsNavigation);
+	}
+}
+
 void ADrawerActor::BeginPlay()
 {
 	Super::BeginPlay();
@@ -47,6 +68,7 @@ void ADrawerActor::OnInteract_Implementation(AActor* Interactor)
 	}
 
 	SetActorTickEnabled(true);
+	MarkSaveDirty();
 }
 
 void ADrawerActor::Tick(float DeltaTime)
@@ -78,6 +100,15 @@ void ADrawerActor::Tick(float DeltaTime)
 		FinalLocation.X += CurrentSlide;
 		DrawerMesh->SetRelativeLocation(FinalLocation);
 		SetActorTickEnabled(false);
+
+		// Saved mid-slide: the settled position replaces the one written then
+		MarkSaveDirty();
+
+		// Refresh nav only once the slide has settled, so bounds match the final pose
+		if (bAffectsNavigation && NavModifier)
+		{
+			NavModifier->SetOpenState(bIsOpen);
+		}
 	}
 }
 
@@ -97,6 +128,12 @@ void ADrawerActor::WriteSaveData_Implementation(USereneSaveGame* SaveGame)
 		return;
 	}
 
+	// Closed at rest is the level default; nothing to restore.
+	if (!bIsOpen && FMath::IsNearlyZero(CurrentSlide))
+	{
+		return;
+	}
+
 	FSavedDrawerState State;
 	State.DrawerId = GetFName();
 	State.bIsOpen = bIsOpen;
@@ -113,29 +150,49 @@ void ADrawerActor::ReadSaveData_Implementation(USereneSaveGame* SaveGame)
 	}
 
 	const FName MyId = GetFName();
-	for (const FSavedDrawerState& State : SaveGame->DrawerStates)
+	const FSavedDrawerState* State = SaveGame->FindDrawerState(MyId);
+	if (!State)
 	{
-		if (State.DrawerId == MyId)
-		{
-			bIsOpen = State.bIsOpen;
-			CurrentSlide = State.CurrentSlide;
-
-			// Snap drawer mesh to saved position (no interpolation on load)
-			if (DrawerMesh)
-			{
-				FVector NewLocation = DrawerInitialLocation;
-				NewLocation.X += CurrentSlide;
-				DrawerMesh->SetRelativeLocation(NewLocation);
-			}
-
-			// Update interaction text to match state
-			InteractionText = bIsOpen
-				? NSLOCTEXT("Interaction", "DrawerClose", "Close")
-				: NSLOCTEXT("Interaction", "DrawerOpen", "Open");
-
-			UE_LOG(LogSerene, Verbose, TEXT("ADrawerActor [%s]: Restored from save (open=%d, slide=%.1f)"),
-				*MyId.ToString(), bIsOpen, CurrentSlide);
-			return;
-		}
+		return;
 	}
+
+	bIsOpen = State->bIsOpen;
+	CurrentSlide = State->CurrentSlide;
+
+	// Snap to saved position (no interpolation on load)
+	ApplyStateImmediate();
+
+	UE_LOG(LogSerene, Verbose, TEXT("ADrawerActor [%s]: Restored from save (open=%d, slide=%.1f)"),
+		*MyId.ToString(), bIsOpen, CurrentSlide);
+}
+
+void ADrawerActor::ResetToLevelDefault_Implementation()
+{
+	bIsOpen = false;
+	CurrentSlide = 0.0f;
+
+	ApplyStateImmediate();
+}
+
+void ADrawerActor::ApplyStateImmediate()
+{
+	if (DrawerMesh)
+	{
+		FVector NewLocation = DrawerInitialLocation;
+		NewLocation.X += CurrentSlide;
+		DrawerMesh->SetRelativeLocation(NewLocation);
+	}
+
+	// Resume the slide only if restored mid-animation
+	SetActorTickEnabled(!FMath::IsNearlyEqual(CurrentSlide, bIsOpen ? OpenDistance : 0.0f, 0.05f));
+
+	if (bAffectsNavigation && NavModifier)
+	{
+		NavModifier->SetOpenState(bIsOpen);
+	}
+
+	// Update interaction text to match state
+	InteractionText = bIsOpen
+		? NSLOCTEXT("Interaction", "DrawerClose", "Close")
+		: NSLOCTEXT("Interaction", "DrawerOpen", "Open");
 }
@@ -1,6 +1,8 @@
 // Copyright Null Lantern.
 
 #include "Interaction/InteractableBase.h"
+#include "Interaction/SaveableInterface.h"
+#include "Save/SaveableRegistrySubsystem.h"
 
 AInteractableBase::AInteractableBase()
 {
@@ -14,6 +16,38 @@ AInteractableBase::AInteractableBase()
 	InteractionText = NSLOCTEXT("Interaction", "Default", "Interact");
 }
 
+void AInteractableBase::BeginPlay()
+{
+	Super::BeginPlay();
+
+	// Saveables are gathered and restored through the registry, not by world iteration
+	if (Implements<USaveable>())
+	{
+		if (USaveableRegistrySubsystem* Registry = GetWorld()->GetSubsystem<USaveableRegistrySubsystem>())
+		{
+			Registry->RegisterSaveable(this);
+		}
+	}
+}
+
+void AInteractableBase::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (USaveableRegistrySubsystem* Registry = GetWorld()->GetSubsystem<USaveableRegistrySubsystem>())
+	{
+		Registry->UnregisterSaveable(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void AInteractableBase::MarkSaveDirty()
+{
+	if (USaveableRegistrySubsystem* Registry = GetWorld()->GetSubsystem<USaveableRegistrySubsystem>())
+	{
+		Registry->MarkDirty(this);
+	}
+}
+
 FText AInteractableBase::GetInteractionText_Implementation() const
 {
 	return InteractionText;
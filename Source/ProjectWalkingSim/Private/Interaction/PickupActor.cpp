@@ -2,12 +2,14 @@
 
 #include "Interaction/PickupActor.h"
 
+#include "Interaction/PickupInstancingSubsystem.h"
 #include "Inventory/InventoryComponent.h"
 #include "Inventory/ItemDataAsset.h"
+#include "Inventory/ItemRegistrySubsystem.h"
 #include "Save/SaveSubsystem.h"
+#include "Save/SereneSaveGame.h"
 #include "Tags/SereneTags.h"
 #include "Core/SereneLogChannels.h"
-#include "Engine/AssetManager.h"
 
 APickupActor::APickupActor()
 {
@@ -19,31 +21,22 @@ void APickupActor::BeginPlay()
 {
 	Super::BeginPlay();
 
-	// Look up item data to set proper interaction text with item name
-	if (ItemId != NAME_None)
+	if (CanBeInstanced())
 	{
-		UAssetManager& AssetManager = UAssetManager::Get();
-
-		// Get all registered Item assets and find the one with matching ItemId
-		TArray<FPrimaryAssetId> AssetList;
-		AssetManager.GetPrimaryAssetIdList(FPrimaryAssetType("Item"), AssetList);
-
-		for (const FPrimaryAssetId& AssetId : AssetList)
+		if (UPickupInstancingSubsystem* Instancing = GetWorld()->GetSubsystem<UPickupInstancingSubsystem>())
 		{
-			UObject* LoadedObject = AssetManager.GetPrimaryAssetObject(AssetId);
-			if (!LoadedObject)
-			{
-				FSoftObjectPath AssetPath = AssetManager.GetPrimaryAssetPath(AssetId);
-				if (!AssetPath.IsNull())
-				{
-					// Synchronous load -- acceptable for <30 items. Consider LoadPrimaryAssetsAsync if item count grows.
-				LoadedObject = AssetPath.TryLoad();
-				}
-			}
+			Instancing->RegisterPickup(this);
+		}
+	}
 
-			if (const UItemDataAsset* ItemData = Cast<UItemDataAsset>(LoadedObject))
+	// Interaction text with the item name, once the item registry has loaded (usually already)
+	if (ItemId != NAME_None)
+	{
+		if (UItemRegistrySubsystem* Items = GetGameInstance() ? GetGameInstance()->GetSubsystem<UItemRegistrySubsystem>() : nullptr)
+		{
+			Items->CallOrRegisterOnReady(FSimpleDelegate::CreateWeakLambda(this, [this, Items]()
 			{
-				if (ItemData->ItemId == ItemId)
+				if (const UItemDataAsset* ItemData = Items->FindItem(ItemId))
 				{
 					if (!ItemData->DisplayName.IsEmpty())
 					{
@@ -51,13 +44,42 @@ void APickupActor::BeginPlay()
 							NSLOCTEXT("Interaction", "PickUpItem", "Pick Up {0}"),
 							ItemData->DisplayName);
 					}
-					return; // Found our item, done
 				}
-			}
+				else
+				{
+					UE_LOG(LogSerene, Warning, TEXT("APickupActor::BeginPlay - Item '%s' not found in item registry"), *ItemId.ToString());
+				}
+			}));
 		}
+	}
+}
+
+void APickupActor::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UPickupInstancingSubsystem* Instancing = GetWorld()->GetSubsystem<UPickupInstancingSubsystem>())
+	{
+		Instancing->UnregisterPickup(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
 
-		UE_LOG(LogSerene, Warning, TEXT("APickupActor::BeginPlay - Item '%s' not found in Asset Manager"), *ItemId.ToString());
+bool APickupActor::CanBeInstanced() const
+{
+	if (!IsLevelPlaced() || !MeshComponent || !MeshComponent->GetStaticMesh() || MeshComponent->IsSimulatingPhysics())
+	{
+		return false;
+	}
+
+	// Instances share the mesh's own materials.
+	for (const TObjectPtr<UMaterialInterface>& Override : MeshComponent->OverrideMaterials)
+	{
+		if (Override)
+		{
+			return false;
+		}
 	}
+	return true;
 }
 
 bool APickupActor::CanInteract_Implementation(AActor* Interactor) const
@@ -129,7 +151,7 @@ void APickupActor::OnInteract_Implementation(AActor* Interactor)
 
 		if (bDestroyOnPickup)
 		{
-			// Notify save subsystem before destruction so reload can re-destroy this pickup
+			// Notify save subsystem before removal so reload can remove this pickup again
 			if (UGameInstance* GI = GetGameInstance())
 			{
 				if (USaveSubsystem* SaveSys = GI->GetSubsystem<USaveSubsystem>())
@@ -137,7 +159,15 @@ void APickupActor::OnInteract_Implementation(AActor* Interactor)
 					SaveSys->TrackDestroyedPickup(GetFName());
 				}
 			}
-			Destroy();
+
+			if (IsLevelPlaced())
+			{
+				SetPickedUp(true);
+			}
+			else
+			{
+				Destroy();
+			}
 		}
 	}
 	else
@@ -201,6 +231,47 @@ void APickupActor::WriteSaveData_Implementation(USereneSaveGame* SaveGame)
 
 void APickupActor::ReadSaveData_Implementation(USereneSaveGame* SaveGame)
 {
-	// Pickup destruction is handled by SaveSubsystem::ApplyPendingSaveData
-	// which destroys pickups by FName. No-op.
+	// Level-placed pickups that were picked up before the save are removed again.
+	if (SaveGame && SaveGame->IsPickupDestroyed(GetFName()))
+	{
+		UE_LOG(LogSerene, Verbose, TEXT("APickupActor [%s]: Picked up in save, removing"), *GetFName().ToString());
+		if (IsLevelPlaced())
+		{
+			SetPickedUp(true);
+		}
+		else
+		{
+			Destroy();
+		}
+	}
+}
+
+void APickupActor::ResetToLevelDefault_Implementation()
+{
+	// Runtime-spawned pickups (discarded items) did not exist at level start.
+	if (!IsLevelPlaced())
+	{
+		Destroy();
+		return;
+	}
+
+	SetPickedUp(false);
+}
+
+void APickupActor::SetPickedUp(bool bNewPickedUp)
+{
+	if (bPickedUp == bNewPickedUp)
+	{
+		return;
+	}
+
+	bPickedUp = bNewPickedUp;
+	SetActorHiddenInGame(bPickedUp);
+	SetActorEnableCollision(!bPickedUp);
+
+	// Parked pickups draw no instance either.
+	if (UPickupInstancingSubsystem* Instancing = GetWorld()->GetSubsystem<UPickupInstancingSubsystem>())
+	{
+		Instancing->RefreshPickup(this);
+	}
 }
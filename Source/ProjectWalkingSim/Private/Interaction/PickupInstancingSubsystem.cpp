@@ -0,0 +1,300 @@
+// Copyright Null Lantern.
+
+#include "Interaction/PickupInstancingSubsystem.h"
+#include "Interaction/PickupActor.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Engine/StaticMesh.h"
+#include "Kismet/GameplayStatics.h"
+#include "HAL/IConsoleManager.h"
+#include "Core/SereneLogChannels.h"
+
+static TAutoConsoleVariable<int32> CVarPickupsInstanced(
+	TEXT("Serene.Pickups.Instanced"),
+	1,
+	TEXT("1 = resting level-placed pickups are drawn as mesh instances until the player comes near. Read when a pickup registers."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarPickupsPromoteRadius(
+	TEXT("Serene.Pickups.PromoteRadius"),
+	400.0f,
+	TEXT("Distance (cm) from the player at which an instanced pickup becomes its own interactable actor. Keep above the interaction range."),
+	ECVF_Default);
+
+void UPickupInstancingSubsystem::Deinitialize()
+{
+	Entries.Empty();
+	FreeEntries.Empty();
+	PickupToEntry.Empty();
+	Grid.Empty();
+	PromotedEntries.Empty();
+	Batches.Empty();
+	BatchComponents.Empty();
+	BatchOwner = nullptr;
+
+	Super::Deinitialize();
+}
+
+bool UPickupInstancingSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId UPickupInstancingSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UPickupInstancingSubsystem, STATGROUP_Tickables);
+}
+
+FIntPoint UPickupInstancingSubsystem::GetCell(const FVector& Location) const
+{
+	return FIntPoint(
+		FMath::FloorToInt32(Location.X / CellSize),
+		FMath::FloorToInt32(Location.Y / CellSize));
+}
+
+// ---------------------------------------------------------------------------
+// Registration
+// ---------------------------------------------------------------------------
+
+void UPickupInstancingSubsystem::RegisterPickup(APickupActor* Pickup)
+{
+	if (!Pickup || PickupToEntry.Contains(Pickup) || CVarPickupsInstanced.GetValueOnGameThread() == 0)
+	{
+		return;
+	}
+
+	UStaticMeshComponent* Mesh = Pickup->GetPickupMesh();
+	UStaticMesh* StaticMesh = Mesh ? Mesh->GetStaticMesh() : nullptr;
+	if (!StaticMesh)
+	{
+		return;
+	}
+
+	const int32 BatchIndex = FindOrAddBatch(StaticMesh, Pickup);
+	if (BatchIndex == INDEX_NONE)
+	{
+		return;
+	}
+
+	const int32 EntryIndex = FreeEntries.Num() > 0 ? FreeEntries.Pop(EAllowShrinking::No) : Entries.AddDefaulted();
+
+	FPickupEntry& Entry = Entries[EntryIndex];
+	Entry = FPickupEntry();
+	Entry.Pickup = Pickup;
+	Entry.Location = Pickup->GetActorLocation();
+	Entry.MeshTransform = Mesh->GetComponentTransform();
+	Entry.BatchIndex = BatchIndex;
+	Entry.MeshCollision = Mesh->GetCollisionEnabled();
+
+	FMeshBatch& Batch = Batches[BatchIndex];
+	UInstancedStaticMeshComponent* Instances = BatchComponents[BatchIndex];
+	Entry.InstanceIndex = Batch.FreeInstances.Num() > 0
+		? Batch.FreeInstances.Pop(EAllowShrinking::No)
+		: Instances->AddInstance(Entry.MeshTransform, /*bWorldSpace=*/ true);
+
+	PickupToEntry.Add(Pickup, EntryIndex);
+	Grid.FindOrAdd(GetCell(Entry.Location)).Add(EntryIndex);
+
+	// Demoted: the instance draws it, the actor keeps no visible mesh or collision.
+	Mesh->SetVisibility(false);
+	Mesh->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	UpdateInstance(Entry);
+
+	UE_LOG(LogSerene, Verbose, TEXT("PickupInstancing: Registered %s (%d pickups, %d meshes)"),
+		*Pickup->GetName(), PickupToEntry.Num(), Batches.Num());
+}
+
+void UPickupInstancingSubsystem::UnregisterPickup(APickupActor* Pickup)
+{
+	int32 EntryIndex = INDEX_NONE;
+	if (!Pickup || !PickupToEntry.RemoveAndCopyValue(Pickup, EntryIndex))
+	{
+		return;
+	}
+
+	FPickupEntry& Entry = Entries[EntryIndex];
+	if (!Entry.bPromoted)
+	{
+		Promote(EntryIndex);
+	}
+	PromotedEntries.RemoveSingleSwap(EntryIndex, EAllowShrinking::No);
+
+	if (TArray<int32>* Cell = Grid.Find(GetCell(Entry.Location)))
+	{
+		Cell->RemoveSingleSwap(EntryIndex, EAllowShrinking::No);
+	}
+
+	// Promote hid the instance; keep it for the next pickup of this mesh.
+	Batches[Entry.BatchIndex].FreeInstances.Add(Entry.InstanceIndex);
+
+	Entry = FPickupEntry();
+	FreeEntries.Add(EntryIndex);
+}
+
+void UPickupInstancingSubsystem::RefreshPickup(const APickupActor* Pickup)
+{
+	if (const int32* EntryIndex = PickupToEntry.Find(Pickup))
+	{
+		UpdateInstance(Entries[*EntryIndex]);
+	}
+}
+
+int32 UPickupInstancingSubsystem::FindOrAddBatch(UStaticMesh* Mesh, const APickupActor* Pickup)
+{
+	for (int32 BatchIndex = 0; BatchIndex < Batches.Num(); ++BatchIndex)
+	{
+		if (Batches[BatchIndex].Mesh.Get() == Mesh)
+		{
+			return BatchIndex;
+		}
+	}
+
+	UWorld* World = GetWorld();
+	if (!BatchOwner)
+	{
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.Name = TEXT("PickupInstances");
+		SpawnParams.NameMode = FActorSpawnParameters::ESpawnActorNameMode::Requested;
+		SpawnParams.ObjectFlags |= RF_Transient;
+		BatchOwner = World->SpawnActor<AActor>(AActor::StaticClass(), FTransform::Identity, SpawnParams);
+		if (!BatchOwner)
+		{
+			return INDEX_NONE;
+		}
+
+		USceneComponent* Root = NewObject<USceneComponent>(BatchOwner, TEXT("Root"));
+		BatchOwner->SetRootComponent(Root);
+		Root->RegisterComponent();
+	}
+
+	UInstancedStaticMeshComponent* Instances = NewObject<UInstancedStaticMeshComponent>(BatchOwner);
+	Instances->SetStaticMesh(Mesh);
+	Instances->SetMobility(EComponentMobility::Movable);
+	Instances->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	Instances->SetCanEverAffectNavigation(false);
+	if (const UStaticMeshComponent* Source = Pickup->GetPickupMesh())
+	{
+		Instances->SetCastShadow(Source->CastShadow);
+	}
+	Instances->SetupAttachment(BatchOwner->GetRootComponent());
+	Instances->RegisterComponent();
+	BatchOwner->AddInstanceComponent(Instances);
+
+	FMeshBatch& Batch = Batches.AddDefaulted_GetRef();
+	Batch.Mesh = Mesh;
+	return BatchComponents.Add(Instances);
+}
+
+// ---------------------------------------------------------------------------
+// Promotion
+// ---------------------------------------------------------------------------
+
+void UPickupInstancingSubsystem::UpdateInstance(const FPickupEntry& Entry)
+{
+	UInstancedStaticMeshComponent* Instances = BatchComponents[Entry.BatchIndex];
+	if (!IsValid(Instances))
+	{
+		return; // World teardown: the batch owner went first
+	}
+
+	const APickupActor* Pickup = Entry.Pickup.Get();
+	const bool bShowInstance = Pickup && !Entry.bPromoted && !Pickup->IsPickedUp();
+
+	FTransform Transform = Entry.MeshTransform;
+	if (!bShowInstance)
+	{
+		Transform.SetScale3D(FVector::ZeroVector);
+	}
+
+	Instances->UpdateInstanceTransform(
+		Entry.InstanceIndex, Transform, /*bWorldSpace=*/ true, /*bMarkRenderStateDirty=*/ true);
+}
+
+void UPickupInstancingSubsystem::Promote(int32 EntryIndex)
+{
+	FPickupEntry& Entry = Entries[EntryIndex];
+	Entry.bPromoted = true;
+	PromotedEntries.Add(EntryIndex);
+
+	// Mesh back before the instance goes, so the pickup never blinks out for a frame.
+	if (APickupActor* Pickup = Entry.Pickup.Get())
+	{
+		if (UStaticMeshComponent* Mesh = Pickup->GetPickupMesh())
+		{
+			Mesh->SetVisibility(true);
+			Mesh->SetCollisionEnabled(Entry.MeshCollision);
+		}
+	}
+	UpdateInstance(Entry);
+}
+
+void UPickupInstancingSubsystem::Demote(int32 EntryIndex)
+{
+	FPickupEntry& Entry = Entries[EntryIndex];
+	Entry.bPromoted = false;
+	PromotedEntries.RemoveSingleSwap(EntryIndex, EAllowShrinking::No);
+
+	UpdateInstance(Entry);
+	if (APickupActor* Pickup = Entry.Pickup.Get())
+	{
+		if (UStaticMeshComponent* Mesh = Pickup->GetPickupMesh())
+		{
+			Mesh->SetVisibility(false);
+			Mesh->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+		}
+	}
+}
+
+void UPickupInstancingSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	TimeSinceCheck += DeltaTime;
+	if (TimeSinceCheck < PromoteCheckInterval || PickupToEntry.Num() == 0)
+	{
+		return;
+	}
+	TimeSinceCheck = 0.0f;
+
+	const APawn* Player = UGameplayStatics::GetPlayerPawn(GetWorld(), 0);
+	if (!Player)
+	{
+		return;
+	}
+
+	const FVector PlayerLocation = Player->GetActorLocation();
+	const float PromoteRadius = FMath::Max(0.0f, CVarPickupsPromoteRadius.GetValueOnGameThread());
+	const float DemoteRadius = PromoteRadius * DemoteRadiusScale;
+
+	// Iterate backwards: Demote swap-removes from PromotedEntries.
+	for (int32 i = PromotedEntries.Num() - 1; i >= 0; --i)
+	{
+		const int32 EntryIndex = PromotedEntries[i];
+		if (FVector::DistSquared(Entries[EntryIndex].Location, PlayerLocation) > FMath::Square(DemoteRadius))
+		{
+			Demote(EntryIndex);
+		}
+	}
+
+	const FIntPoint MinCell = GetCell(PlayerLocation - FVector(PromoteRadius));
+	const FIntPoint MaxCell = GetCell(PlayerLocation + FVector(PromoteRadius));
+	for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+	{
+		for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+		{
+			const TArray<int32>* Cell = Grid.Find(FIntPoint(X, Y));
+			if (!Cell)
+			{
+				continue;
+			}
+
+			for (const int32 EntryIndex : *Cell)
+			{
+				const FPickupEntry& Entry = Entries[EntryIndex];
+				if (!Entry.bPromoted && FVector::DistSquared(Entry.Location, PlayerLocation) <= FMath::Square(PromoteRadius))
+				{
+					Promote(EntryIndex);
+				}
+			}
+		}
+	}
+}
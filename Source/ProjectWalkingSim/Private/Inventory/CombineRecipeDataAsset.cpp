@@ -0,0 +1,8 @@
+// Copyright Null Lantern.
+
+#include "Inventory/CombineRecipeDataAsset.h"
+
+FPrimaryAssetId UCombineRecipeDataAsset::GetPrimaryAssetId() const
+{
+	return FPrimaryAssetId("CombineRecipes", GetFName());
+}
@@ -0,0 +1,54 @@
+// Copyright Null Lantern.
+
+#include "Inventory/CombineRecipeTable.h"
+#include "Core/SereneLogChannels.h"
+
+FCombineRecipeTable::FRecipeKey::FRecipeKey(TConstArrayView<FName> InIngredients)
+	: Ingredients(InIngredients)
+{
+	Ingredients.Sort(FNameFastLess());
+}
+
+bool FCombineRecipeTable::Add(const FCombineRecipe& Recipe, const FString& SourceName)
+{
+	if (Recipe.Ingredients.Num() < 2 || Recipe.Ingredients.Contains(NAME_None) || Recipe.ResultItemId.IsNone())
+	{
+		UE_LOG(LogSerene, Warning, TEXT("CombineRecipeTable: %s has a recipe without two ingredients and a result -- ignored"),
+			*SourceName);
+		return false;
+	}
+
+	// Combining takes one unit per slot and an item stacks into one slot, so a repeated ingredient never matches
+	for (int32 i = 1; i < Recipe.Ingredients.Num(); ++i)
+	{
+		if (MakeArrayView(Recipe.Ingredients.GetData(), i).Contains(Recipe.Ingredients[i]))
+		{
+			UE_LOG(LogSerene, Warning, TEXT("CombineRecipeTable: %s has a recipe for '%s' listing '%s' twice -- ignored"),
+				*SourceName, *Recipe.ResultItemId.ToString(), *Recipe.Ingredients[i].ToString());
+			return false;
+		}
+	}
+
+	FRecipeKey Key(Recipe.Ingredients);
+	if (const int32* Existing = RecipeIndices.Find(Key))
+	{
+		UE_LOG(LogSerene, Warning, TEXT("CombineRecipeTable: %s repeats the ingredients of the recipe for '%s' -- ignored"),
+			*SourceName, *Recipes[*Existing].ResultItemId.ToString());
+		return false;
+	}
+
+	RecipeIndices.Add(MoveTemp(Key), Recipes.Add(Recipe));
+	return true;
+}
+
+const FCombineRecipe* FCombineRecipeTable::Find(TConstArrayView<FName> Ingredients) const
+{
+	const int32* Index = RecipeIndices.Find(FRecipeKey(Ingredients));
+	return Index ? &Recipes[*Index] : nullptr;
+}
+
+void FCombineRecipeTable::Reset()
+{
+	Recipes.Reset();
+	RecipeIndices.Reset();
+}
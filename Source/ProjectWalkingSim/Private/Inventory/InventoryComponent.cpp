@@ -3,9 +3,11 @@
 #include "Inventory/InventoryComponent.h"
 
 #include "Inventory/ItemDataAsset.h"
+#include "Inventory/ItemRegistrySubsystem.h"
+#include "Inventory/CombineRecipeDataAsset.h"
 #include "Interaction/PickupActor.h"
 #include "Core/SereneLogChannels.h"
-#include "Engine/AssetManager.h"
+#include "Engine/GameInstance.h"
 #include "GameFramework/Pawn.h"
 #include "GameFramework/PlayerController.h"
 
@@ -17,46 +19,6 @@ UInventoryComponent::UInventoryComponent()
 	Slots.SetNum(MaxSlots);
 }
 
-void UInventoryComponent::BeginPlay()
-{
-	Super::BeginPlay();
-
-	LoadItemRegistry();
-	InitCombineRecipes();
-}
-
-void UInventoryComponent::LoadItemRegistry()
-{
-	UAssetManager& AssetManager = UAssetManager::Get();
-
-	TArray<FPrimaryAssetId> AssetList;
-	AssetManager.GetPrimaryAssetIdList(FPrimaryAssetType("Item"), AssetList);
-
-	for (const FPrimaryAssetId& AssetId : AssetList)
-	{
-		// Try to get already-loaded asset first
-		UObject* LoadedObject = AssetManager.GetPrimaryAssetObject(AssetId);
-
-		// If not loaded, load synchronously via path resolution
-		if (!LoadedObject)
-		{
-			FSoftObjectPath AssetPath = AssetManager.GetPrimaryAssetPath(AssetId);
-			if (!AssetPath.IsNull())
-			{
-				// Synchronous load -- acceptable for <30 items. Consider LoadPrimaryAssetsAsync if item count grows.
-				LoadedObject = AssetPath.TryLoad();
-			}
-		}
-
-		if (UItemDataAsset* ItemData = Cast<UItemDataAsset>(LoadedObject))
-		{
-			ItemRegistry.Add(ItemData->ItemId, ItemData);
-		}
-	}
-
-	UE_LOG(LogSerene, Log, TEXT("UInventoryComponent::LoadItemRegistry - Registered %d items"), ItemRegistry.Num());
-}
-
 bool UInventoryComponent::TryAddItem(FName ItemId, int32 Quantity)
 {
 	if (ItemId == NAME_None || Quantity <= 0)
@@ -73,19 +35,42 @@ bool UInventoryComponent::TryAddItem(FName ItemId, int32 Quantity)
 		return false;
 	}
 
+	TArray<FInventorySlotChange> Changes;
+	const int32 RemainingQuantity = FillSlots(ItemId, *ItemData, Quantity, Changes);
+	if (RemainingQuantity > 0)
+	{
+		// Inventory full
+		UE_LOG(LogSerene, Log, TEXT("UInventoryComponent::TryAddItem - Inventory full, cannot add %s (remaining: %d)"),
+			*ItemId.ToString(), RemainingQuantity);
+
+		// Stacks topped up before running out of room still changed
+		BroadcastSlotChanges(Changes);
+		OnInventoryActionFailed.Broadcast(ItemId, NSLOCTEXT("Inventory", "Full", "Inventory is full"));
+		return false;
+	}
+
+	UE_LOG(LogSerene, Log, TEXT("UInventoryComponent::TryAddItem - Added %s x%d to inventory"), *ItemId.ToString(), Quantity);
+	BroadcastSlotChanges(Changes);
+	return true;
+}
+
+int32 UInventoryComponent::FillSlots(FName ItemId, const UItemDataAsset& ItemData, int32 Quantity, TArray<FInventorySlotChange>& Changes)
+{
 	int32 RemainingQuantity = Quantity;
 
 	// If stackable, try to add to existing stacks first
-	if (ItemData->bIsStackable)
+	if (ItemData.bIsStackable)
 	{
-		for (FInventorySlot& Slot : Slots)
+		for (int32 i = 0; i < Slots.Num(); ++i)
 		{
-			if (Slot.ItemId == ItemId && Slot.Quantity < ItemData->MaxStackSize)
+			FInventorySlot& Slot = Slots[i];
+			if (Slot.ItemId == ItemId && Slot.Quantity < ItemData.MaxStackSize)
 			{
-				const int32 SpaceInStack = ItemData->MaxStackSize - Slot.Quantity;
+				const int32 SpaceInStack = ItemData.MaxStackSize - Slot.Quantity;
 				const int32 ToAdd = FMath::Min(RemainingQuantity, SpaceInStack);
 				Slot.Quantity += ToAdd;
 				RemainingQuantity -= ToAdd;
+				Changes.Emplace(i, EInventorySlotChange::Quantity);
 
 				if (RemainingQuantity <= 0)
 				{
@@ -101,26 +86,20 @@ bool UInventoryComponent::TryAddItem(FName ItemId, int32 Quantity)
 		const int32 EmptySlot = FindFirstEmptySlot();
 		if (EmptySlot < 0)
 		{
-			// Inventory full
-			UE_LOG(LogSerene, Log, TEXT("UInventoryComponent::TryAddItem - Inventory full, cannot add %s (remaining: %d)"),
-				*ItemId.ToString(), RemainingQuantity);
-
-			OnInventoryActionFailed.Broadcast(ItemId, NSLOCTEXT("Inventory", "Full", "Inventory is full"));
-			return false;
+			break;
 		}
 
-		const int32 ToAdd = ItemData->bIsStackable
-			? FMath::Min(RemainingQuantity, ItemData->MaxStackSize)
+		const int32 ToAdd = ItemData.bIsStackable
+			? FMath::Min(RemainingQuantity, ItemData.MaxStackSize)
 			: 1;
 
 		Slots[EmptySlot].ItemId = ItemId;
 		Slots[EmptySlot].Quantity = ToAdd;
 		RemainingQuantity -= ToAdd;
+		Changes.Emplace(EmptySlot, EInventorySlotChange::Added);
 	}
 
-	UE_LOG(LogSerene, Log, TEXT("UInventoryComponent::TryAddItem - Added %s x%d to inventory"), *ItemId.ToString(), Quantity);
-	OnInventoryChanged.Broadcast();
-	return true;
+	return RemainingQuantity;
 }
 
 bool UInventoryComponent::RemoveItem(int32 SlotIndex, int32 Quantity)
@@ -145,6 +124,7 @@ bool UInventoryComponent::RemoveItem(int32 SlotIndex, int32 Quantity)
 		return false;
 	}
 
+	const FInventorySlot Before = Slot;
 	Slot.Quantity -= Quantity;
 	if (Slot.Quantity <= 0)
 	{
@@ -153,7 +133,9 @@ bool UInventoryComponent::RemoveItem(int32 SlotIndex, int32 Quantity)
 	}
 
 	UE_LOG(LogSerene, Log, TEXT("UInventoryComponent::RemoveItem - Removed %d from slot %d"), Quantity, SlotIndex);
-	OnInventoryChanged.Broadcast();
+	TArray<FInventorySlotChange> Changes;
+	RecordSlotChange(Changes, SlotIndex, Before);
+	BroadcastSlotChanges(Changes);
 	return true;
 }
 
@@ -194,11 +176,9 @@ bool UInventoryComponent::IsFull() const
 
 const UItemDataAsset* UInventoryComponent::GetItemData(FName ItemId) const
 {
-	if (const TObjectPtr<UItemDataAsset>* Found = ItemRegistry.Find(ItemId))
-	{
-		return *Found;
-	}
-	return nullptr;
+	const UGameInstance* GameInstance = GetWorld() ? GetWorld()->GetGameInstance() : nullptr;
+	UItemRegistrySubsystem* Items = GameInstance ? GameInstance->GetSubsystem<UItemRegistrySubsystem>() : nullptr;
+	return Items ? Items->FindItem(ItemId) : nullptr;
 }
 
 void UInventoryComponent::DiscardItem(int32 SlotIndex)
@@ -285,78 +265,161 @@ int32 UInventoryComponent::FindSlotWithItem(FName ItemId) const
 	return -1;
 }
 
-void UInventoryComponent::InitCombineRecipes()
-{
-	// Add recipes here as the demo expands. Format: {ItemA, ItemB} -> Result
-	// Example (commented out until actual items exist):
-	// CombineRecipes.Add(TPair<FName,FName>(FName("Fuse"), FName("FuseBox")), FName("PoweredFuseBox"));
-
-	UE_LOG(LogSerene, Log, TEXT("UInventoryComponent::InitCombineRecipes - %d recipes loaded."), CombineRecipes.Num());
-}
-
 void UInventoryComponent::RestoreSavedInventory(const TArray<FInventorySlot>& SavedSlots)
 {
+	const TArray<FInventorySlot> Before = MoveTemp(Slots);
 	Slots = SavedSlots;
 	Slots.SetNum(MaxSlots); // Ensure exactly 8 slots
-	OnInventoryChanged.Broadcast();
+
+	// Only slots the save actually changes need redrawing
+	TArray<FInventorySlotChange> Changes;
+	for (int32 i = 0; i < Slots.Num(); ++i)
+	{
+		RecordSlotChange(Changes, i, Before.IsValidIndex(i) ? Before[i] : FInventorySlot());
+	}
+	BroadcastSlotChanges(Changes);
 
 	UE_LOG(LogSerene, Log, TEXT("UInventoryComponent::RestoreSavedInventory - Restored %d slots"), SavedSlots.Num());
 }
 
-bool UInventoryComponent::TryCombineItems(int32 SlotIndexA, int32 SlotIndexB)
+void UInventoryComponent::RecordSlotChange(TArray<FInventorySlotChange>& Changes, int32 SlotIndex, const FInventorySlot& Before) const
 {
-	// Validate slot indices
-	if (!Slots.IsValidIndex(SlotIndexA) || !Slots.IsValidIndex(SlotIndexB))
+	const FInventorySlot& After = Slots[SlotIndex];
+	if (Before.IsEmpty() && After.IsEmpty())
 	{
-		UE_LOG(LogSerene, Warning, TEXT("UInventoryComponent::TryCombineItems - Invalid slot index (A=%d, B=%d)"), SlotIndexA, SlotIndexB);
-		return false;
+		return;
 	}
 
-	// Ensure slots are not the same
-	if (SlotIndexA == SlotIndexB)
+	EInventorySlotChange Kind;
+	if (Before.IsEmpty())
 	{
-		UE_LOG(LogSerene, Warning, TEXT("UInventoryComponent::TryCombineItems - Cannot combine slot with itself (slot %d)"), SlotIndexA);
-		return false;
+		Kind = EInventorySlotChange::Added;
 	}
+	else if (After.IsEmpty())
+	{
+		Kind = EInventorySlotChange::Removed;
+	}
+	else if (Before.ItemId != After.ItemId)
+	{
+		Kind = EInventorySlotChange::Replaced;
+	}
+	else if (Before.Quantity != After.Quantity)
+	{
+		Kind = EInventorySlotChange::Quantity;
+	}
+	else
+	{
+		return;
+	}
+
+	Changes.Emplace(SlotIndex, Kind);
+}
 
-	// Ensure neither slot is empty
-	if (Slots[SlotIndexA].IsEmpty() || Slots[SlotIndexB].IsEmpty())
+void UInventoryComponent::BroadcastSlotChanges(const TArray<FInventorySlotChange>& Changes)
+{
+	if (Changes.Num() == 0)
 	{
-		UE_LOG(LogSerene, Warning, TEXT("UInventoryComponent::TryCombineItems - Cannot combine empty slots (A=%d empty=%d, B=%d empty=%d)"),
-			SlotIndexA, Slots[SlotIndexA].IsEmpty(), SlotIndexB, Slots[SlotIndexB].IsEmpty());
-		return false;
+		return;
 	}
 
-	const FName ItemIdA = Slots[SlotIndexA].ItemId;
-	const FName ItemIdB = Slots[SlotIndexB].ItemId;
+	UE_LOG(LogSerene, Verbose, TEXT("UInventoryComponent::BroadcastSlotChanges - %d slot(s) changed"), Changes.Num());
+	OnInventorySlotsChanged.Broadcast(Changes);
+	OnInventoryChanged.Broadcast();
+}
+
+bool UInventoryComponent::TryCombineItems(int32 SlotIndexA, int32 SlotIndexB)
+{
+	return TryCombineSlots({ SlotIndexA, SlotIndexB });
+}
 
-	// Check recipe map with both orderings (order-independent)
-	FName* ResultItem = CombineRecipes.Find(TPair<FName, FName>(ItemIdA, ItemIdB));
-	if (!ResultItem)
+bool UInventoryComponent::TryCombineSlots(const TArray<int32>& SlotIndices)
+{
+	TArray<FName, TInlineAllocator<MaxSlots>> Ingredients;
+	for (int32 i = 0; i < SlotIndices.Num(); ++i)
 	{
-		ResultItem = CombineRecipes.Find(TPair<FName, FName>(ItemIdB, ItemIdA));
+		const int32 SlotIndex = SlotIndices[i];
+
+		// Validate slot indices
+		if (!Slots.IsValidIndex(SlotIndex))
+		{
+			UE_LOG(LogSerene, Warning, TEXT("UInventoryComponent::TryCombineSlots - Invalid slot index %d"), SlotIndex);
+			return false;
+		}
+
+		// Ensure slots are not the same
+		for (int32 j = 0; j < i; ++j)
+		{
+			if (SlotIndices[j] == SlotIndex)
+			{
+				UE_LOG(LogSerene, Warning, TEXT("UInventoryComponent::TryCombineSlots - Cannot combine slot with itself (slot %d)"), SlotIndex);
+				return false;
+			}
+		}
+
+		// Ensure no slot is empty
+		if (Slots[SlotIndex].IsEmpty())
+		{
+			UE_LOG(LogSerene, Warning, TEXT("UInventoryComponent::TryCombineSlots - Cannot combine empty slot %d"), SlotIndex);
+			return false;
+		}
+
+		Ingredients.Add(Slots[SlotIndex].ItemId);
 	}
 
-	if (ResultItem)
+	const UGameInstance* GameInstance = GetWorld() ? GetWorld()->GetGameInstance() : nullptr;
+	UItemRegistrySubsystem* Items = GameInstance ? GameInstance->GetSubsystem<UItemRegistrySubsystem>() : nullptr;
+
+	// One hash lookup; ingredient order does not matter
+	const FCombineRecipe* Recipe = (Items && Ingredients.Num() >= 2) ? Items->FindRecipe(Ingredients) : nullptr;
+	if (Recipe)
 	{
-		// Recipe found - perform combination
-		UE_LOG(LogSerene, Log, TEXT("UInventoryComponent::TryCombineItems - Combining %s + %s = %s"),
-			*ItemIdA.ToString(), *ItemIdB.ToString(), *ResultItem->ToString());
+		const UItemDataAsset* ResultData = GetItemData(Recipe->ResultItemId);
+		if (!ResultData)
+		{
+			UE_LOG(LogSerene, Warning, TEXT("UInventoryComponent::TryCombineSlots - Result '%s' not found in registry"),
+				*Recipe->ResultItemId.ToString());
+			return false;
+		}
 
-		// Remove 1 quantity from both source slots
-		RemoveItem(SlotIndexA, 1);
-		RemoveItem(SlotIndexB, 1);
+		// Consume and add in place, then undo if the result does not fit (consumed stacks may free no slot)
+		const TArray<FInventorySlot> Before = Slots;
+		for (const int32 SlotIndex : SlotIndices)
+		{
+			FInventorySlot& Slot = Slots[SlotIndex];
+			if (--Slot.Quantity <= 0)
+			{
+				Slot = FInventorySlot();
+			}
+		}
+
+		// Changes are diffed below instead: a consumed slot may be refilled with the result
+		TArray<FInventorySlotChange> FillChanges;
+		if (FillSlots(Recipe->ResultItemId, *ResultData, Recipe->ResultQuantity, FillChanges) > 0)
+		{
+			Slots = Before;
 
-		// Add the result item
-		TryAddItem(*ResultItem, 1);
+			UE_LOG(LogSerene, Log, TEXT("UInventoryComponent::TryCombineSlots - No room for %s x%d"),
+				*Recipe->ResultItemId.ToString(), Recipe->ResultQuantity);
 
-		// Note: RemoveItem and TryAddItem already broadcast OnInventoryChanged
+			OnInventoryActionFailed.Broadcast(Recipe->ResultItemId, NSLOCTEXT("Inventory", "Full", "Inventory is full"));
+			return false;
+		}
+
+		UE_LOG(LogSerene, Log, TEXT("UInventoryComponent::TryCombineSlots - Combined %d items = %s x%d"),
+			Ingredients.Num(), *Recipe->ResultItemId.ToString(), Recipe->ResultQuantity);
+
+		TArray<FInventorySlotChange> Changes;
+		for (int32 i = 0; i < Slots.Num(); ++i)
+		{
+			RecordSlotChange(Changes, i, Before[i]);
+		}
+		BroadcastSlotChanges(Changes);
 		return true;
 	}
 
 	// No recipe found
-	UE_LOG(LogSerene, Log, TEXT("UInventoryComponent::TryCombineItems - No recipe for %s + %s"),
-		*ItemIdA.ToString(), *ItemIdB.ToString());
+	UE_LOG(LogSerene, Log, TEXT("UInventoryComponent::TryCombineSlots - No recipe for %s"),
+		*FString::JoinBy(Ingredients, TEXT(" + "), [](const FName& Ingredient) { return Ingredient.ToString(); }));
 
 	OnCombineFailed.Broadcast(NSLOCTEXT("Inventory", "CombineFailed", "These items cannot be combined"));
 	return false;
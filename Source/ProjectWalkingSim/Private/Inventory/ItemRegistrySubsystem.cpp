@@ -0,0 +1,152 @@
+// Copyright Null Lantern.
+
+#include "Inventory/ItemRegistrySubsystem.h"
+#include "Inventory/ItemDataAsset.h"
+#include "Inventory/CombineRecipeDataAsset.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
+#include "Core/SereneLogChannels.h"
+
+void UItemRegistrySubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	UAssetManager::CallOrRegister_OnCompletedInitialScan(
+		FSimpleMulticastDelegate::FDelegate::CreateUObject(this, &UItemRegistrySubsystem::StartLoad));
+}
+
+void UItemRegistrySubsystem::Deinitialize()
+{
+	if (LoadHandle.IsValid())
+	{
+		LoadHandle->CancelHandle();
+		LoadHandle.Reset();
+	}
+	ItemsById.Empty();
+	Recipes.Reset();
+	OnReady.Clear();
+	bReady = false;
+
+	Super::Deinitialize();
+}
+
+// ---------------------------------------------------------------------------
+// Lookup
+// ---------------------------------------------------------------------------
+
+const UItemDataAsset* UItemRegistrySubsystem::FindItem(FName ItemId)
+{
+	WaitForLoad(*ItemId.ToString());
+
+	const TObjectPtr<UItemDataAsset>* Found = ItemsById.Find(ItemId);
+	return Found ? Found->Get() : nullptr;
+}
+
+const FCombineRecipe* UItemRegistrySubsystem::FindRecipe(TConstArrayView<FName> Ingredients)
+{
+	WaitForLoad(TEXT("combine recipe"));
+
+	return Recipes.Find(Ingredients);
+}
+
+void UItemRegistrySubsystem::WaitForLoad(const TCHAR* Reason)
+{
+	if (bReady)
+	{
+		return;
+	}
+
+	// StartLoad has not run: the Asset Manager's initial scan is still going and cannot be waited on
+	if (!LoadHandle.IsValid())
+	{
+		UE_LOG(LogSerene, Warning, TEXT("ItemRegistry: '%s' requested before the Asset Manager finished its initial scan -- not found. Use CallOrRegisterOnReady."), Reason);
+		return;
+	}
+
+	UE_LOG(LogSerene, Warning, TEXT("ItemRegistry: '%s' requested before the item load finished, waiting for it"), Reason);
+	LoadHandle->WaitUntilComplete();
+	OnItemsLoaded();
+}
+
+void UItemRegistrySubsystem::CallOrRegisterOnReady(FSimpleDelegate&& Delegate)
+{
+	if (bReady)
+	{
+		Delegate.ExecuteIfBound();
+		return;
+	}
+	OnReady.Add(MoveTemp(Delegate));
+}
+
+// ---------------------------------------------------------------------------
+// Loading
+// ---------------------------------------------------------------------------
+
+void UItemRegistrySubsystem::StartLoad()
+{
+	UAssetManager& AssetManager = UAssetManager::Get();
+
+	TArray<FPrimaryAssetId> AssetList;
+	AssetManager.GetPrimaryAssetIdList(FPrimaryAssetType("Item"), AssetList);
+
+	TArray<FPrimaryAssetId> RecipeAssetList;
+	AssetManager.GetPrimaryAssetIdList(FPrimaryAssetType("CombineRecipes"), RecipeAssetList);
+	AssetList.Append(RecipeAssetList);
+
+	LoadHandle = AssetManager.LoadPrimaryAssets(AssetList, TArray<FName>(),
+		FStreamableDelegate::CreateUObject(this, &UItemRegistrySubsystem::OnItemsLoaded));
+
+	// No handle: nothing to load, or everything was already in memory and the delegate has run.
+	if (!LoadHandle.IsValid())
+	{
+		OnItemsLoaded();
+	}
+}
+
+void UItemRegistrySubsystem::OnItemsLoaded()
+{
+	if (bReady)
+	{
+		return;
+	}
+
+	TArray<UObject*> Loaded;
+	UAssetManager::Get().GetPrimaryAssetObjectList(FPrimaryAssetType("Item"), Loaded);
+
+	ItemsById.Reserve(Loaded.Num());
+	for (UObject* Object : Loaded)
+	{
+		UItemDataAsset* ItemData = Cast<UItemDataAsset>(Object);
+		if (!ItemData)
+		{
+			continue;
+		}
+
+		if (const TObjectPtr<UItemDataAsset>* Existing = ItemsById.Find(ItemData->ItemId))
+		{
+			UE_LOG(LogSerene, Warning, TEXT("ItemRegistry: %s has ItemId '%s' already used by %s -- ignored"),
+				*ItemData->GetName(), *ItemData->ItemId.ToString(), *(*Existing)->GetName());
+			continue;
+		}
+		ItemsById.Add(ItemData->ItemId, ItemData);
+	}
+
+	Loaded.Reset();
+	UAssetManager::Get().GetPrimaryAssetObjectList(FPrimaryAssetType("CombineRecipes"), Loaded);
+	for (UObject* Object : Loaded)
+	{
+		if (const UCombineRecipeDataAsset* RecipeAsset = Cast<UCombineRecipeDataAsset>(Object))
+		{
+			for (const FCombineRecipe& Recipe : RecipeAsset->Recipes)
+			{
+				Recipes.Add(Recipe, RecipeAsset->GetName());
+			}
+		}
+	}
+
+	bReady = true;
+	UE_LOG(LogSerene, Log, TEXT("ItemRegistry: registered %d items, %d combine recipes"), ItemsById.Num(), Recipes.Num());
+
+	OnReady.Broadcast();
+	OnReady.Clear();
+}
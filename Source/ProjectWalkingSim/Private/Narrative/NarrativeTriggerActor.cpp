@@ -5,6 +5,7 @@
 #include "Components/BoxComponent.h"
 #include "GameFramework/Pawn.h"
 #include "Kismet/GameplayStatics.h"
+#include "Save/SaveSubsystem.h"
 #include "Core/SereneLogChannels.h"
 
 ANarrativeTriggerActor::ANarrativeTriggerActor()
@@ -20,6 +21,12 @@ ANarrativeTriggerActor::ANarrativeTriggerActor()
 	TriggerBox->OnComponentBeginOverlap.AddDynamic(this, &ANarrativeTriggerActor::OnTriggerOverlap);
 }
 
+void ANarrativeTriggerActor::Rearm()
+{
+	bHasTriggered = false;
+	GetWorldTimerManager().ClearTimer(TriggerTimerHandle);
+}
+
 void ANarrativeTriggerActor::OnTriggerOverlap(
 	UPrimitiveComponent* OverlappedComponent,
 	AActor* OtherActor,
@@ -62,6 +69,14 @@ void ANarrativeTriggerActor::OnTriggerOverlap(
 
 void ANarrativeTriggerActor::ExecuteTrigger()
 {
+	if (bCreatesCheckpoint)
+	{
+		if (USaveSubsystem* SaveSub = GetGameInstance()->GetSubsystem<USaveSubsystem>())
+		{
+			SaveSub->CaptureCheckpoint(GetFName());
+		}
+	}
+
 	if (MonologueSound)
 	{
 		UGameplayStatics::PlaySound2D(this, MonologueSound);
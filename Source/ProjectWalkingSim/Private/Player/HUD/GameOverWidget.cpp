@@ -4,7 +4,6 @@
 
 #include "Components/Button.h"
 #include "Components/TextBlock.h"
-#include "Kismet/GameplayStatics.h"
 #include "Kismet/KismetSystemLibrary.h"
 #include "Save/SaveSubsystem.h"
 #include "Core/SereneLogChannels.h"
@@ -13,9 +12,16 @@ void UGameOverWidget::NativeConstruct()
 {
 	Super::NativeConstruct();
 
-	// Determine button text based on whether any saves exist
+	// Determine button text based on whether a checkpoint or any saves exist
 	USaveSubsystem* SaveSub = GetGameInstance()->GetSubsystem<USaveSubsystem>();
-	if (SaveSub && SaveSub->HasAnySave())
+	if (SaveSub && SaveSub->HasCheckpoint())
+	{
+		if (LoadLastSaveButtonText)
+		{
+			LoadLastSaveButtonText->SetText(FText::FromString(TEXT("Retry")));
+		}
+	}
+	else if (SaveSub && SaveSub->HasAnySave())
 	{
 		if (LoadLastSaveButtonText)
 		{
@@ -45,19 +51,19 @@ void UGameOverWidget::NativeConstruct()
 void UGameOverWidget::HandleLoadClicked()
 {
 	USaveSubsystem* SaveSub = GetGameInstance()->GetSubsystem<USaveSubsystem>();
-	if (SaveSub && SaveSub->HasAnySave())
+	if (SaveSub && SaveSub->HasCheckpoint())
+	{
+		// Restored in place from memory; removes this widget
+		SaveSub->RetryFromCheckpoint();
+	}
+	else if (SaveSub && SaveSub->HasAnySave())
 	{
 		SaveSub->LoadLatestSave();
 	}
-	else
+	else if (SaveSub)
 	{
-		// No saves -- restart the current level
-		UWorld* World = GetWorld();
-		if (World)
-		{
-			const FString CurrentLevel = UGameplayStatics::GetCurrentLevelName(World);
-			UGameplayStatics::OpenLevel(World, FName(*CurrentLevel));
-		}
+		// No saves -- restart the current level (in place; removes this widget)
+		SaveSub->RestartLevel();
 	}
 }
 
@@ -75,39 +75,60 @@ void UInventoryWidget::RefreshSlots(const TArray<FInventorySlot>& Slots, UInvent
 {
 	CachedInventoryComp = InventoryComp;
 
-	UE_LOG(LogSerene, Log, TEXT("UInventoryWidget::RefreshSlots - Slots.Num()=%d, SlotWidgets.Num()=%d, InventoryComp=%s"),
+	UE_LOG(LogSerene, Verbose, TEXT("UInventoryWidget::RefreshSlots - Slots.Num()=%d, SlotWidgets.Num()=%d, InventoryComp=%s"),
 		Slots.Num(), SlotWidgets.Num(), InventoryComp ? TEXT("valid") : TEXT("null"));
 
 	const int32 NumSlots = FMath::Min(Slots.Num(), SlotWidgets.Num());
 
 	for (int32 i = 0; i < NumSlots; ++i)
 	{
-		const FInventorySlot& SlotData = Slots[i];
-		UInventorySlotWidget* SlotWidget = SlotWidgets[i];
+		RefreshSlotWidget(i, Slots[i]);
+	}
+}
 
-		if (!SlotWidget)
+void UInventoryWidget::RefreshChangedSlots(const TArray<FInventorySlotChange>& Changes, UInventoryComponent* InventoryComp)
+{
+	CachedInventoryComp = InventoryComp;
+	if (!InventoryComp)
+	{
+		return;
+	}
+
+	const TArray<FInventorySlot>& Slots = InventoryComp->GetSlots();
+	for (const FInventorySlotChange& Change : Changes)
+	{
+		if (Slots.IsValidIndex(Change.SlotIndex) && SlotWidgets.IsValidIndex(Change.SlotIndex))
 		{
-			UE_LOG(LogSerene, Warning, TEXT("  Slot %d: SlotWidget is null"), i);
-			continue;
+			RefreshSlotWidget(Change.SlotIndex, Slots[Change.SlotIndex]);
 		}
+	}
+}
 
-		if (SlotData.IsEmpty())
-		{
-			SlotWidget->ClearSlot();
+void UInventoryWidget::RefreshSlotWidget(int32 SlotIndex, const FInventorySlot& SlotData)
+{
+	UInventorySlotWidget* SlotWidget = SlotWidgets[SlotIndex];
+	if (!SlotWidget)
+	{
+		UE_LOG(LogSerene, Warning, TEXT("UInventoryWidget::RefreshSlotWidget - Slot %d: SlotWidget is null"), SlotIndex);
+		return;
+	}
 
-			// If selected slot becomes empty, deselect
-			if (SelectedSlotIndex == i)
-			{
-				DeselectSlot();
-			}
-		}
-		else
+	if (SlotData.IsEmpty())
+	{
+		SlotWidget->ClearSlot();
+
+		// If selected slot becomes empty, deselect
+		if (SelectedSlotIndex == SlotIndex)
 		{
-			UE_LOG(LogSerene, Log, TEXT("  Slot %d: ItemId=%s, Quantity=%d"), i, *SlotData.ItemId.ToString(), SlotData.Quantity);
-			const UItemDataAsset* ItemData = InventoryComp ? InventoryComp->GetItemData(SlotData.ItemId) : nullptr;
-			SlotWidget->SetSlotData(SlotData, ItemData);
+			DeselectSlot();
 		}
 	}
+	else
+	{
+		UE_LOG(LogSerene, VeryVerbose, TEXT("  Slot %d: ItemId=%s, Quantity=%d"), SlotIndex, *SlotData.ItemId.ToString(), SlotData.Quantity);
+		const UItemDataAsset* ItemData = CachedInventoryComp ? CachedInventoryComp->GetItemData(SlotData.ItemId) : nullptr;
+		SlotWidget->SetSlotData(SlotData, ItemData);
+	}
 }
 
 void UInventoryWidget::ShowInventory()
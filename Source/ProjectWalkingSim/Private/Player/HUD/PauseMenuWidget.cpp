@@ -51,7 +51,7 @@ void UPauseMenuWidget::HandleContinueClicked()
 	if (SaveSub)
 	{
 		SaveSub->LoadLatestSave();
-		// LoadLatestSave restarts the level; widget will be destroyed
+		// LoadLatestSave restarts or restores the level; either way this widget is removed
 	}
 }
 
@@ -93,14 +93,19 @@ void UPauseMenuWidget::HandleQuitClicked()
 	UKismetSystemLibrary::QuitGame(GetWorld(), GetOwningPlayer(), EQuitPreference::Quit, false);
 }
 
-void UPauseMenuWidget::HandleLoadMenuClosed()
+void UPauseMenuWidget::CloseLoadMenu()
 {
-	// Remove load menu widget
 	if (LoadMenuInstance)
 	{
 		LoadMenuInstance->RemoveFromParent();
 		LoadMenuInstance = nullptr;
 	}
+}
+
+void UPauseMenuWidget::HandleLoadMenuClosed()
+{
+	// Remove load menu widget
+	CloseLoadMenu();
 
 	// Show pause menu again
 	SetVisibility(ESlateVisibility::Visible);
@@ -48,6 +48,22 @@ void USaveLoadMenuWidget::NativeConstruct()
 	{
 		ConfirmOverlay->SetVisibility(ESlateVisibility::Collapsed);
 	}
+
+	if (USaveSubsystem* SaveSub = GetGameInstance() ? GetGameInstance()->GetSubsystem<USaveSubsystem>() : nullptr)
+	{
+		LoadFailedHandle = SaveSub->OnSlotLoadFailed.AddUObject(this, &USaveLoadMenuWidget::HandleSlotLoadFailed);
+	}
+}
+
+void USaveLoadMenuWidget::NativeDestruct()
+{
+	if (USaveSubsystem* SaveSub = GetGameInstance() ? GetGameInstance()->GetSubsystem<USaveSubsystem>() : nullptr)
+	{
+		SaveSub->OnSlotLoadFailed.Remove(LoadFailedHandle);
+	}
+	LoadFailedHandle.Reset();
+
+	Super::NativeDestruct();
 }
 
 void USaveLoadMenuWidget::OpenMenu(ESaveLoadMode Mode)
@@ -124,7 +140,8 @@ void USaveLoadMenuWidget::HandleSlotClicked(int32 SlotIndex)
 		if (bSlotOccupied)
 		{
 			SaveSub->LoadFromSlot(SlotIndex);
-			// LoadFromSlot restarts the level; widget will be destroyed
+			// A good save restarts or restores the level, which removes this widget;
+			// a bad one leaves it open (HandleSlotLoadFailed)
 		}
 		// Empty slot in Load mode -- ignore click
 	}
@@ -200,3 +217,13 @@ TArray<USaveSlotWidget*> USaveLoadMenuWidget::GetSlotWidgets() const
 {
 	return { Slot0, Slot1, Slot2 };
 }
+
+void USaveLoadMenuWidget::HandleSlotLoadFailed(int32 SlotIndex)
+{
+	if (MenuTitleText)
+	{
+		MenuTitleText->SetText(FText::FromString(TEXT("Save could not be loaded")));
+	}
+
+	RefreshSlots();
+}
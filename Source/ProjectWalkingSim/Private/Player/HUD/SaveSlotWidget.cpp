@@ -5,9 +5,9 @@
 #include "Components/Button.h"
 #include "Components/Image.h"
 #include "Components/TextBlock.h"
-#include "ImageUtils.h"
+#include "Engine/Texture2D.h"
+#include "Save/SaveSubsystem.h"
 #include "Save/SaveTypes.h"
-#include "Core/SereneLogChannels.h"
 
 void USaveSlotWidget::NativeConstruct()
 {
@@ -17,11 +17,28 @@ void USaveSlotWidget::NativeConstruct()
 	{
 		SlotButton->OnClicked.AddDynamic(this, &USaveSlotWidget::HandleSlotButtonClicked);
 	}
+
+	if (USaveSubsystem* SaveSub = GetGameInstance() ? GetGameInstance()->GetSubsystem<USaveSubsystem>() : nullptr)
+	{
+		ThumbnailReadyHandle = SaveSub->OnSlotThumbnailReady.AddUObject(this, &USaveSlotWidget::HandleThumbnailReady);
+	}
+}
+
+void USaveSlotWidget::NativeDestruct()
+{
+	if (USaveSubsystem* SaveSub = GetGameInstance() ? GetGameInstance()->GetSubsystem<USaveSubsystem>() : nullptr)
+	{
+		SaveSub->OnSlotThumbnailReady.Remove(ThumbnailReadyHandle);
+	}
+	ThumbnailReadyHandle.Reset();
+
+	Super::NativeDestruct();
 }
 
 void USaveSlotWidget::SetSlotData(int32 InSlotIndex, const FSaveSlotInfo& Info, bool bIsOccupied)
 {
 	SlotIndex = InSlotIndex;
+	bOccupied = bIsOccupied;
 
 	// Set slot label (1-indexed for display)
 	if (SlotLabelText)
@@ -38,21 +55,9 @@ void USaveSlotWidget::SetSlotData(int32 InSlotIndex, const FSaveSlotInfo& Info,
 			TimestampText->SetText(FText::FromString(FormattedTime));
 		}
 
-		// Reconstruct thumbnail from saved JPEG bytes
-		if (ThumbnailImage && Info.ScreenshotData.Num() > 0)
-		{
-			UTexture2D* Texture = FImageUtils::ImportBufferAsTexture2D(
-				TArrayView64<const uint8>(Info.ScreenshotData.GetData(), Info.ScreenshotData.Num()));
-
-			if (Texture)
-			{
-				ThumbnailImage->SetBrushFromTexture(Texture);
-			}
-			else
-			{
-				UE_LOG(LogSerene, Warning, TEXT("USaveSlotWidget::SetSlotData - Failed to reconstruct thumbnail for slot %d"), InSlotIndex);
-			}
-		}
+		// Cached texture, or placeholder now and the texture once decoded (HandleThumbnailReady)
+		USaveSubsystem* SaveSub = GetGameInstance() ? GetGameInstance()->GetSubsystem<USaveSubsystem>() : nullptr;
+		SetThumbnail(SaveSub ? SaveSub->GetSlotThumbnail(InSlotIndex) : nullptr);
 	}
 	else
 	{
@@ -62,11 +67,23 @@ void USaveSlotWidget::SetSlotData(int32 InSlotIndex, const FSaveSlotInfo& Info,
 			TimestampText->SetText(FText::FromString(TEXT("Empty")));
 		}
 
-		// Reset thumbnail to default (clear the brush)
-		if (ThumbnailImage)
-		{
-			ThumbnailImage->SetBrushFromTexture(nullptr);
-		}
+		SetThumbnail(nullptr);
+	}
+}
+
+void USaveSlotWidget::SetThumbnail(UTexture2D* Texture)
+{
+	if (ThumbnailImage)
+	{
+		ThumbnailImage->SetBrushFromTexture(Texture ? Texture : PlaceholderThumbnail.Get());
+	}
+}
+
+void USaveSlotWidget::HandleThumbnailReady(int32 ReadySlotIndex, UTexture2D* Texture)
+{
+	if (bOccupied && ReadySlotIndex == SlotIndex)
+	{
+		SetThumbnail(Texture);
 	}
 }
 
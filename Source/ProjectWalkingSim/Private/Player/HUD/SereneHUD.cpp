@@ -68,8 +68,8 @@ void ASereneHUD::BindToCharacter(ASereneCharacter* Character)
 	if (UInventoryComponent* Inventory = Character->FindComponentByClass<UInventoryComponent>())
 	{
 		CachedInventoryComp = Inventory;
-		Inventory->OnInventoryChanged.AddDynamic(this, &ASereneHUD::HandleInventoryChanged);
-		UE_LOG(LogSerene, Log, TEXT("ASereneHUD::BindToCharacter - Bound to InventoryComponent::OnInventoryChanged."));
+		Inventory->OnInventorySlotsChanged.AddDynamic(this, &ASereneHUD::HandleInventorySlotsChanged);
+		UE_LOG(LogSerene, Log, TEXT("ASereneHUD::BindToCharacter - Bound to InventoryComponent::OnInventorySlotsChanged."));
 	}
 }
 
@@ -93,13 +93,22 @@ void ASereneHUD::HandleInteractableChanged(AActor* NewInteractable, FText Intera
 	}
 }
 
-void ASereneHUD::HandleInventoryChanged()
+void ASereneHUD::HandleInventorySlotsChanged(const TArray<FInventorySlotChange>& Changes)
 {
-	UE_LOG(LogSerene, Verbose, TEXT("ASereneHUD::HandleInventoryChanged - HUDWidgetInstance=%s, GetInventoryWidget=%s, CachedInventoryComp=%s"),
+	UE_LOG(LogSerene, Verbose, TEXT("ASereneHUD::HandleInventorySlotsChanged - %d slot(s), HUDWidgetInstance=%s, GetInventoryWidget=%s, CachedInventoryComp=%s"),
+		Changes.Num(),
 		HUDWidgetInstance ? TEXT("valid") : TEXT("null"),
 		(HUDWidgetInstance && HUDWidgetInstance->GetInventoryWidget()) ? TEXT("valid") : TEXT("null"),
 		CachedInventoryComp ? TEXT("valid") : TEXT("null"));
 
+	if (HUDWidgetInstance && HUDWidgetInstance->GetInventoryWidget() && CachedInventoryComp)
+	{
+		HUDWidgetInstance->GetInventoryWidget()->RefreshChangedSlots(Changes, CachedInventoryComp);
+	}
+}
+
+void ASereneHUD::RefreshInventoryWidget()
+{
 	if (HUDWidgetInstance && HUDWidgetInstance->GetInventoryWidget() && CachedInventoryComp)
 	{
 		HUDWidgetInstance->GetInventoryWidget()->RefreshSlots(
@@ -115,7 +124,7 @@ void ASereneHUD::ShowInventory()
 	{
 		HUDWidgetInstance->GetInventoryWidget()->ShowInventory();
 		// Do an immediate refresh so slots are current when inventory opens
-		HandleInventoryChanged();
+		RefreshInventoryWidget();
 	}
 }
 
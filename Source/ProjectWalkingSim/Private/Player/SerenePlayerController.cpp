@@ -435,6 +435,23 @@ void ASerenePlayerController::TogglePauseMenu()
 	}
 }
 
+void ASerenePlayerController::CloseMenusForRestore()
+{
+	if (bIsPaused)
+	{
+		if (PauseMenuInstance)
+		{
+			PauseMenuInstance->CloseLoadMenu();
+		}
+		HandlePauseMenuClosed();
+	}
+
+	if (bIsInventoryOpen)
+	{
+		CloseInventory();
+	}
+}
+
 void ASerenePlayerController::HandlePauseMenuClosed()
 {
 	bIsPaused = false;
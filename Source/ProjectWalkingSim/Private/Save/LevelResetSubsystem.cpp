@@ -0,0 +1,210 @@
+// Copyright Null Lantern.
+
+#include "Save/LevelResetSubsystem.h"
+#include "Save/SaveableRegistrySubsystem.h"
+#include "AI/WendigoCharacter.h"
+#include "AI/WendigoPoolSubsystem.h"
+#include "Core/SereneGameMode.h"
+#include "Hiding/HidingComponent.h"
+#include "Inventory/InventoryComponent.h"
+#include "Narrative/NarrativeTriggerActor.h"
+#include "Player/SereneCharacter.h"
+#include "Player/SerenePlayerController.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "EngineUtils.h"
+#include "Kismet/GameplayStatics.h"
+#include "Core/SereneLogChannels.h"
+
+void ULevelResetSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	WorldBeginPlayHandle = GetWorld()->OnWorldBeginPlay.AddUObject(this, &ULevelResetSubsystem::CaptureLevelStart);
+}
+
+void ULevelResetSubsystem::Deinitialize()
+{
+	GetWorld()->OnWorldBeginPlay.Remove(WorldBeginPlayHandle);
+	WendigoStarts.Empty();
+	PlayerStartInventory.Empty();
+
+	Super::Deinitialize();
+}
+
+bool ULevelResetSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+// ---------------------------------------------------------------------------
+// Capture
+// ---------------------------------------------------------------------------
+
+void ULevelResetSubsystem::CaptureLevelStart()
+{
+	UWorld* World = GetWorld();
+
+	// Includes pool-prewarmed Wendigos (dormant) and any activated during BeginPlay
+	WendigoStarts.Reset();
+	for (TActorIterator<AWendigoCharacter> It(World); It; ++It)
+	{
+		FWendigoStart& Start = WendigoStarts.AddDefaulted_GetRef();
+		Start.Wendigo = *It;
+		Start.Transform = It->GetActorTransform();
+		Start.PatrolRoute = It->GetPatrolRoute();
+		Start.bDormant = It->IsDormant();
+	}
+
+	if (ASereneCharacter* Player = Cast<ASereneCharacter>(UGameplayStatics::GetPlayerPawn(World, 0)))
+	{
+		bHasPlayerStart = true;
+		PlayerStartTransform = Player->GetActorTransform();
+		PlayerStartControlRotation = Player->GetController() ? Player->GetController()->GetControlRotation() : Player->GetActorRotation();
+
+		if (const UInventoryComponent* Inventory = Player->FindComponentByClass<UInventoryComponent>())
+		{
+			PlayerStartInventory = Inventory->GetSlots();
+		}
+	}
+
+	bCapturedLevelStart = true;
+
+	UE_LOG(LogSerene, Log, TEXT("LevelReset: captured level start (%d Wendigos, player=%d)"),
+		WendigoStarts.Num(), bHasPlayerStart);
+}
+
+// ---------------------------------------------------------------------------
+// Reset
+// ---------------------------------------------------------------------------
+
+void ULevelResetSubsystem::ResetToLevelStart()
+{
+	if (!bCapturedLevelStart)
+	{
+		UE_LOG(LogSerene, Warning, TEXT("LevelReset: level start not captured yet, ignoring reset"));
+		return;
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	if (USaveableRegistrySubsystem* Registry = GetWorld()->GetSubsystem<USaveableRegistrySubsystem>())
+	{
+		Registry->ResetAll();
+	}
+
+	ResetWendigos();
+	ResetNarrativeTriggers();
+	ResetPlayer();
+
+	UE_LOG(LogSerene, Log, TEXT("LevelReset: reset to level start in %.2f ms"),
+		(FPlatformTime::Seconds() - StartTime) * 1000.0);
+}
+
+void ULevelResetSubsystem::ResetWendigos()
+{
+	UWorld* World = GetWorld();
+	UWendigoPoolSubsystem* Pool = World->GetSubsystem<UWendigoPoolSubsystem>();
+
+	TSet<const AWendigoCharacter*> Restored;
+	for (const FWendigoStart& Start : WendigoStarts)
+	{
+		AWendigoCharacter* Wendigo = Start.Wendigo.Get();
+		if (!Wendigo)
+		{
+			continue;
+		}
+		Restored.Add(Wendigo);
+
+		// Dormant round-trip stops the State Tree (running ExitState, e.g. GrabAttack re-enables input)
+		// and parks it at the root, so waking starts with a clean slate. Pooled Wendigos acquired since go back to the pool.
+		if (Start.bDormant && Pool)
+		{
+			Pool->Release(Wendigo);
+		}
+		Wendigo->SetDormant(true);
+		Wendigo->SetActorTransform(Start.Transform, /*bSweep=*/ false, nullptr, ETeleportType::TeleportPhysics);
+		Wendigo->ResetAIState();
+		Wendigo->SetPatrolRoute(Start.PatrolRoute.Get());
+		Wendigo->SetDormant(Start.bDormant);
+	}
+
+	// Spawned after level start without the pool (empty-pool fallback): park them in it.
+	for (TActorIterator<AWendigoCharacter> It(World); It; ++It)
+	{
+		if (Restored.Contains(*It))
+		{
+			continue;
+		}
+
+		It->ResetAIState();
+		if (Pool)
+		{
+			Pool->Release(*It);
+		}
+		else
+		{
+			It->SetDormant(true);
+		}
+	}
+}
+
+void ULevelResetSubsystem::ResetNarrativeTriggers()
+{
+	// Re-armed before the player moves, so a restore position inside a trigger fires it again.
+	for (TActorIterator<ANarrativeTriggerActor> It(GetWorld()); It; ++It)
+	{
+		It->Rearm();
+	}
+}
+
+void ULevelResetSubsystem::ResetPlayer()
+{
+	UWorld* World = GetWorld();
+	ASereneCharacter* Player = Cast<ASereneCharacter>(UGameplayStatics::GetPlayerPawn(World, 0));
+	if (!Player)
+	{
+		return;
+	}
+
+	if (UHidingComponent* Hiding = Player->FindComponentByClass<UHidingComponent>())
+	{
+		if (Hiding->GetHidingState() != EHidingState::Free)
+		{
+			Hiding->ExitHidingSpot();
+		}
+	}
+	Player->StopSprint();
+	Player->StopCrouching();
+
+	if (!bHasPlayerStart)
+	{
+		// Pawn did not exist at capture time: fall back to the game mode's player start.
+		AGameModeBase* GameMode = World->GetAuthGameMode();
+		AActor* PlayerStart = GameMode && Player->GetController() ? GameMode->FindPlayerStart(Player->GetController()) : nullptr;
+		PlayerStartTransform = PlayerStart ? PlayerStart->GetActorTransform() : Player->GetActorTransform();
+		PlayerStartControlRotation = PlayerStartTransform.Rotator();
+	}
+
+	Player->TeleportTo(PlayerStartTransform.GetLocation(), PlayerStartTransform.Rotator(), /*bIsATest=*/ false, /*bNoCheck=*/ true);
+	if (UCharacterMovementComponent* Movement = Player->GetCharacterMovement())
+	{
+		Movement->StopMovementImmediately();
+	}
+
+	if (UInventoryComponent* Inventory = Player->FindComponentByClass<UInventoryComponent>())
+	{
+		Inventory->RestoreSavedInventory(PlayerStartInventory);
+	}
+
+	// UI and input: what OpenLevel used to clear by destroying widgets and the controller
+	if (ASereneGameMode* GameMode = Cast<ASereneGameMode>(World->GetAuthGameMode()))
+	{
+		GameMode->ClearGameOver();
+	}
+
+	if (ASerenePlayerController* PC = Cast<ASerenePlayerController>(Player->GetController()))
+	{
+		PC->CloseMenusForRestore();
+		PC->SetControlRotation(PlayerStartControlRotation);
+	}
+}
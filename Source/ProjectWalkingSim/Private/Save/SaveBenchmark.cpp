@@ -0,0 +1,278 @@
+// Copyright Null Lantern.
+
+#include "Save/SaveBenchmark.h"
+#include "Save/SaveableRegistrySubsystem.h"
+#include "Save/SaveFileFormat.h"
+#include "Save/SaveSnapshot.h"
+#include "Save/SereneSaveGame.h"
+#include "Interaction/DoorActor.h"
+#include "Interaction/DrawerActor.h"
+#include "Interaction/PickupActor.h"
+#include "Inventory/InventoryComponent.h"
+#include "Engine/World.h"
+#include "Kismet/GameplayStatics.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Core/SereneLogChannels.h"
+
+#if !UE_BUILD_SHIPPING
+
+namespace
+{
+	TAutoConsoleVariable<int32> CVarSaveBenchmarkIterations(
+		TEXT("Serene.Save.Benchmark.Iterations"),
+		5,
+		TEXT("Timed repeats per save benchmark stage (the mean is reported)."),
+		ECVF_Default);
+
+	FAutoConsoleCommandWithWorldAndArgs SaveBenchmarkCommand(
+		TEXT("Serene.Save.Benchmark"),
+		TEXT("Benchmark save/load against synthetic worlds: Serene.Save.Benchmark [Count ...] (default 100 1000 10000)"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+		{
+			TArray<int32> Counts;
+			for (const FString& Arg : Args)
+			{
+				const int32 Count = FCString::Atoi(*Arg);
+				if (Count > 0)
+				{
+					Counts.Add(Count);
+				}
+			}
+			if (Counts.Num() == 0)
+			{
+				Counts = { 100, 1000, 10000 };
+			}
+
+			SereneSaveBenchmark::Run(World, Counts, CVarSaveBenchmarkIterations.GetValueOnGameThread());
+		}));
+
+	const TCHAR* BenchmarkSlotName = TEXT("SaveBenchmark");
+
+	/** Synthetic actors are spawned on a grid this far below the level. */
+	constexpr double SyntheticWorldZ = -100000.0;
+	constexpr double SyntheticGridSpacing = 300.0;
+	constexpr int32 SyntheticGridWidth = 100;
+
+	FString GetBenchmarkDir()
+	{
+		return FPaths::ProjectSavedDir() / TEXT("SaveBenchmark");
+	}
+
+	/** Mean milliseconds of Iterations calls to Fn. */
+	template <typename FnType>
+	double TimeMs(int32 Iterations, FnType&& Fn)
+	{
+		const double Start = FPlatformTime::Seconds();
+		for (int32 i = 0; i < Iterations; ++i)
+		{
+			Fn();
+		}
+		return (FPlatformTime::Seconds() - Start) * 1000.0 / Iterations;
+	}
+
+	struct FFormatResult
+	{
+		const TCHAR* Format = TEXT("");
+		double SerializeMs = 0.0;
+		int32 Bytes = 0;
+		double WriteMs = 0.0;
+		double DeserializeMs = 0.0;
+		double ApplyMs = 0.0;
+		bool bRoundTrip = false;
+	};
+
+	bool MatchesSnapshot(const USereneSaveGame* Loaded, const FSaveSnapshot& Snapshot)
+	{
+		return Loaded
+			&& Loaded->DoorStates.Num() == Snapshot.DoorStates.Num()
+			&& Loaded->DrawerStates.Num() == Snapshot.DrawerStates.Num()
+			&& Loaded->DestroyedPickupIds.Num() == Snapshot.DestroyedPickupIds.Num()
+			&& Loaded->InventorySlots.Num() == Snapshot.InventorySlots.Num();
+	}
+
+	/** Serialize / write / read / apply for a file format. Serialize fills Bytes from the snapshot. */
+	template <typename SerializeFnType>
+	FFormatResult MeasureFileFormat(const TCHAR* Format, int32 Iterations, const FSaveSnapshot& Snapshot,
+		USaveableRegistrySubsystem& Registry, SerializeFnType&& Serialize)
+	{
+		FFormatResult Result;
+		Result.Format = Format;
+
+		TArray<uint8> Bytes;
+		Result.SerializeMs = TimeMs(Iterations, [&]() { Bytes.Reset(); Serialize(Bytes); });
+		Result.Bytes = Bytes.Num();
+		Result.WriteMs = TimeMs(Iterations, [&]() { FSaveFileFormat::WriteToSlot(Bytes, BenchmarkSlotName); });
+
+		USereneSaveGame* Loaded = nullptr;
+		Result.DeserializeMs = TimeMs(Iterations, [&]() { Loaded = FSaveFileFormat::Read(Bytes); });
+		Result.bRoundTrip = MatchesSnapshot(Loaded, Snapshot);
+
+		if (Loaded)
+		{
+			Result.ApplyMs = TimeMs(Iterations, [&]() { Registry.ReadAll(Loaded); });
+		}
+		return Result;
+	}
+
+	void RunCount(UWorld* World, USaveableRegistrySubsystem& Registry, int32 Count, int32 Iterations, FString& Csv)
+	{
+		// --- Synthetic world ---
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+		TArray<AActor*> Spawned;
+		Spawned.Reserve(Count * 3);
+
+		// Every other door and drawer differs from its default; every other pickup was collected
+		// (collected pickups are gone from the world, so those ids have no actor).
+		USereneSaveGame* Changes = NewObject<USereneSaveGame>();
+		for (int32 i = 0; i < Count; ++i)
+		{
+			const FVector Location((i % SyntheticGridWidth) * SyntheticGridSpacing,
+				(i / SyntheticGridWidth) * SyntheticGridSpacing, SyntheticWorldZ);
+
+			ADoorActor* Door = World->SpawnActor<ADoorActor>(Location, FRotator::ZeroRotator, SpawnParams);
+			ADrawerActor* Drawer = World->SpawnActor<ADrawerActor>(Location + FVector(0.0, 0.0, 200.0), FRotator::ZeroRotator, SpawnParams);
+			APickupActor* Pickup = World->SpawnActor<APickupActor>(Location + FVector(0.0, 0.0, 400.0), FRotator::ZeroRotator, SpawnParams);
+			Spawned.Append({ Door, Drawer, Pickup });
+			if (!Door || !Drawer || !Pickup)
+			{
+				continue;
+			}
+
+			if (i % 2 == 0)
+			{
+				FSavedDoorState& DoorState = Changes->DoorStates.AddDefaulted_GetRef();
+				DoorState.DoorId = Door->GetFName();
+				DoorState.bIsOpen = true;
+				DoorState.CurrentAngle = 90.0f;
+
+				FSavedDrawerState& DrawerState = Changes->DrawerStates.AddDefaulted_GetRef();
+				DrawerState.DrawerId = Drawer->GetFName();
+				DrawerState.bIsOpen = true;
+				DrawerState.CurrentSlide = 30.0f;
+
+				Changes->DestroyedPickupIds.Add(FName(TEXT("SaveBenchmark_CollectedPickup"), i));
+			}
+		}
+		Registry.ReadAll(Changes);
+
+		// --- Gather ---
+		FSaveSnapshot Snapshot;
+		const double GatherMs = TimeMs(Iterations, [&]()
+		{
+			Registry.MarkAllDirty();
+			Snapshot.DoorStates.Reset();
+			Snapshot.DrawerStates.Reset();
+			Registry.WriteAll(Snapshot);
+		});
+
+		const double GatherIncrementalMs = TimeMs(Iterations, [&]()
+		{
+			Registry.MarkDirty(Spawned[0]);
+			Snapshot.DoorStates.Reset();
+			Snapshot.DrawerStates.Reset();
+			Registry.WriteAll(Snapshot);
+		});
+
+		Snapshot.DestroyedPickupIds = Changes->DestroyedPickupIds;
+		Snapshot.InventorySlots.SetNum(UInventoryComponent::MaxSlots);
+		for (int32 i = 0; i < Snapshot.InventorySlots.Num(); ++i)
+		{
+			Snapshot.InventorySlots[i].ItemId = FName(TEXT("SaveBenchmark_Item"), i);
+			Snapshot.InventorySlots[i].Quantity = 1;
+		}
+		Snapshot.SlotInfo.Timestamp = FDateTime::Now();
+		Snapshot.SlotInfo.MapName = UGameplayStatics::GetCurrentLevelName(World);
+		Snapshot.SlotInfo.InventoryItemCount = Snapshot.InventorySlots.Num();
+
+		// --- Formats ---
+		TArray<FFormatResult> Results;
+
+		Results.Add(MeasureFileFormat(TEXT("Sectioned"), Iterations, Snapshot, Registry, [&Snapshot](TArray<uint8>& Bytes)
+		{
+			FSaveFileFormat::Write(Snapshot, Bytes);
+		}));
+
+		USereneSaveGame* LegacySave = NewObject<USereneSaveGame>();
+		Snapshot.CopyTo(*LegacySave);
+		Results.Add(MeasureFileFormat(TEXT("Legacy"), Iterations, Snapshot, Registry, [LegacySave](TArray<uint8>& Bytes)
+		{
+			UGameplayStatics::SaveGameToMemory(LegacySave, Bytes);
+		}));
+
+		{
+			FFormatResult& Result = Results.AddDefaulted_GetRef();
+			Result.Format = TEXT("Checkpoint");
+
+			FSaveSnapshot Checkpoint;
+			Result.SerializeMs = TimeMs(Iterations, [&]() { Checkpoint = Snapshot; });
+
+			USereneSaveGame* Loaded = nullptr;
+			Result.DeserializeMs = TimeMs(Iterations, [&]()
+			{
+				Loaded = NewObject<USereneSaveGame>();
+				Checkpoint.CopyTo(*Loaded);
+			});
+			Result.bRoundTrip = MatchesSnapshot(Loaded, Snapshot);
+			Result.ApplyMs = TimeMs(Iterations, [&]() { Registry.ReadAll(Loaded); });
+		}
+
+		for (const FFormatResult& Result : Results)
+		{
+			Csv += FString::Printf(TEXT("%d,%s,%d,%d,%.4f,%.4f,%.4f,%d,%.4f,%.4f,%.4f,%d\n"),
+				Count, Result.Format, Registry.GetNumSaveables(), Snapshot.DoorStates.Num() + Snapshot.DrawerStates.Num(),
+				GatherMs, GatherIncrementalMs, Result.SerializeMs, Result.Bytes, Result.WriteMs,
+				Result.DeserializeMs, Result.ApplyMs, Result.bRoundTrip);
+
+			if (!Result.bRoundTrip)
+			{
+				UE_LOG(LogSerene, Warning, TEXT("SaveBenchmark: %s round trip lost records at N=%d"), Result.Format, Count);
+			}
+		}
+
+		UE_LOG(LogSerene, Display, TEXT("SaveBenchmark: N=%d gather %.3f ms (incremental %.3f ms), sectioned %d bytes"),
+			Count, GatherMs, GatherIncrementalMs, Results[0].Bytes);
+
+		for (AActor* Actor : Spawned)
+		{
+			if (IsValid(Actor))
+			{
+				Actor->Destroy();
+			}
+		}
+	}
+}
+
+FString SereneSaveBenchmark::Run(UWorld* World, const TArray<int32>& Counts, int32 Iterations)
+{
+	USaveableRegistrySubsystem* Registry = World ? World->GetSubsystem<USaveableRegistrySubsystem>() : nullptr;
+	if (!Registry || !World->HasBegunPlay())
+	{
+		UE_LOG(LogSerene, Warning, TEXT("SaveBenchmark: needs a game world that has begun play"));
+		return FString();
+	}
+
+	Iterations = FMath::Max(1, Iterations);
+
+	FString Csv = TEXT("Count,Format,Saveables,ChangedRecords,GatherMs,GatherIncrementalMs,SerializeMs,Bytes,WriteMs,DeserializeMs,ApplyMs,RoundTrip\n");
+	for (const int32 Count : Counts)
+	{
+		RunCount(World, *Registry, Count, Iterations, Csv);
+	}
+
+	// The registry snapshot now holds synthetic records; rebuild it from the real saveables on the next save.
+	Registry->MarkAllDirty();
+	UGameplayStatics::DeleteGameInSlot(BenchmarkSlotName, 0);
+
+	const FString Path = GetBenchmarkDir() / FString::Printf(TEXT("SaveBenchmark_%s.csv"), *FDateTime::Now().ToString());
+	FFileHelper::SaveStringToFile(Csv, *Path);
+
+	UE_LOG(LogSerene, Display, TEXT("SaveBenchmark: %d world sizes, %d iterations -> %s"), Counts.Num(), Iterations, *Path);
+	return Path;
+}
+
+#endif // !UE_BUILD_SHIPPING
@@ -0,0 +1,702 @@
+// Copyright Null Lantern.
+
+#include "Save/SaveFileFormat.h"
+#include "Save/SereneSaveGame.h"
+#include "Save/SaveSnapshot.h"
+#include "Kismet/GameplayStatics.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "GenericPlatform/GenericPlatformFile.h"
+#include "Async/MappedFileHandle.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/Compression.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Core/SereneLogChannels.h"
+
+namespace
+{
+	/** 'SRNS' */
+	constexpr uint32 SaveMagic = 0x534E5253;
+
+	/** Sections smaller than this are stored raw; compression overhead would outweigh the gain. */
+	constexpr int32 MinCompressSize = 64;
+
+	/** Slot-file sections at least this large are memory-mapped (where supported) rather than read into a buffer. */
+	constexpr int64 MinMappedSectionSize = 64 * 1024;
+
+	enum class ESaveSection : uint8
+	{
+		Meta,
+		Thumbnail,
+		Names,
+		Player,
+		World
+	};
+
+	enum ESectionFlags : uint8
+	{
+		SectionCompressed = 1 << 0
+	};
+
+	enum EDoorFlags : uint8
+	{
+		DoorOpen         = 1 << 0,
+		DoorLocked       = 1 << 1,
+		DoorOpensReverse = 1 << 2
+	};
+
+	struct FSectionEntry
+	{
+		uint8 Id = 0;
+		uint8 Flags = 0;
+		int32 Offset = 0;
+		int32 StoredSize = 0;
+		int32 RawSize = 0;
+
+		friend FArchive& operator<<(FArchive& Ar, FSectionEntry& Entry)
+		{
+			return Ar << Entry.Id << Entry.Flags << Entry.Offset << Entry.StoredSize << Entry.RawSize;
+		}
+	};
+
+	/** Each distinct FName is written once; sections refer to it by index. */
+	struct FNameTableWriter
+	{
+		TArray<FName> Names;
+		TMap<FName, uint16> Indices;
+
+		/** Index of Name, or INDEX_NONE once the table is full (indices are stored as uint16). */
+		int32 Add(FName Name)
+		{
+			if (const uint16* Existing = Indices.Find(Name))
+			{
+				return *Existing;
+			}
+			if (Names.Num() >= MAX_uint16)
+			{
+				return INDEX_NONE;
+			}
+			const uint16 Index = static_cast<uint16>(Names.Add(Name));
+			Indices.Add(Name, Index);
+			return Index;
+		}
+
+		/** Write Name's index. A full table flags the writer instead of wrapping to another name. */
+		void Write(FArchive& Ar, FName Name)
+		{
+			const int32 Index = Add(Name);
+			if (Index == INDEX_NONE)
+			{
+				Ar.SetError();
+			}
+			uint16 StoredIndex = static_cast<uint16>(FMath::Max(Index, 0));
+			Ar << StoredIndex;
+		}
+	};
+
+	/** Out-of-range indices (corrupt data) read as NAME_None and flag the reader. */
+	FName ResolveName(const TArray<FName>& Names, uint16 Index, FArchive& Ar)
+	{
+		if (!Names.IsValidIndex(Index))
+		{
+			Ar.SetError();
+			return NAME_None;
+		}
+		return Names[Index];
+	}
+
+	// -----------------------------------------------------------------------
+	// Section bodies
+	// -----------------------------------------------------------------------
+
+	/** Element count guarded against corrupt data before allocating. */
+	bool ReadCount(FArchive& Ar, int32& OutCount)
+	{
+		Ar << OutCount;
+		if (OutCount < 0 || OutCount > Ar.TotalSize() - Ar.Tell())
+		{
+			Ar.SetError();
+			return false;
+		}
+		return true;
+	}
+
+	void WriteMeta(FArchive& Ar, const FSaveSlotInfo& Info)
+	{
+		int64 Ticks = Info.Timestamp.GetTicks();
+		FString MapName = Info.MapName;
+		int32 ItemCount = Info.InventoryItemCount;
+		int32 Width = Info.ScreenshotWidth;
+		int32 Height = Info.ScreenshotHeight;
+		Ar << Ticks << MapName << ItemCount << Width << Height;
+	}
+
+	void ReadMeta(FArchive& Ar, FSaveSlotInfo& Info)
+	{
+		int64 Ticks = 0;
+		Ar << Ticks << Info.MapName << Info.InventoryItemCount << Info.ScreenshotWidth << Info.ScreenshotHeight;
+		Info.Timestamp = FDateTime(Ticks);
+	}
+
+	void WritePlayer(FArchive& Ar, const FSaveSnapshot& Snapshot, FNameTableWriter& NameTable)
+	{
+		FVector Location = Snapshot.PlayerLocation;
+		FRotator Rotation = Snapshot.PlayerRotation;
+		Ar << Location << Rotation;
+
+		int32 NumSlots = Snapshot.InventorySlots.Num();
+		Ar << NumSlots;
+		for (const FInventorySlot& Slot : Snapshot.InventorySlots)
+		{
+			NameTable.Write(Ar, Slot.ItemId);
+			int32 Quantity = Slot.Quantity;
+			Ar << Quantity;
+		}
+	}
+
+	void ReadPlayer(FArchive& Ar, USereneSaveGame& SaveGame, const TArray<FName>& Names)
+	{
+		Ar << SaveGame.PlayerLocation << SaveGame.PlayerRotation;
+
+		int32 NumSlots = 0;
+		if (!ReadCount(Ar, NumSlots))
+		{
+			return;
+		}
+
+		SaveGame.InventorySlots.SetNum(NumSlots);
+		for (FInventorySlot& Slot : SaveGame.InventorySlots)
+		{
+			uint16 ItemIndex = 0;
+			Ar << ItemIndex << Slot.Quantity;
+			Slot.ItemId = ResolveName(Names, ItemIndex, Ar);
+		}
+	}
+
+	void WriteWorld(FArchive& Ar, const FSaveSnapshot& Snapshot, FNameTableWriter& NameTable)
+	{
+		int32 NumDoors = Snapshot.DoorStates.Num();
+		Ar << NumDoors;
+		for (const FSavedDoorState& Door : Snapshot.DoorStates)
+		{
+			NameTable.Write(Ar, Door.DoorId);
+			uint8 Flags = static_cast<uint8>((Door.bIsOpen ? DoorOpen : 0)
+				| (Door.bIsLocked ? DoorLocked : 0)
+				| (Door.OpenDirection < 0.0f ? DoorOpensReverse : 0));
+			float Angle = Door.CurrentAngle;
+			Ar << Flags << Angle;
+		}
+
+		int32 NumDrawers = Snapshot.DrawerStates.Num();
+		Ar << NumDrawers;
+		for (const FSavedDrawerState& Drawer : Snapshot.DrawerStates)
+		{
+			NameTable.Write(Ar, Drawer.DrawerId);
+			uint8 bOpen = Drawer.bIsOpen ? 1 : 0;
+			float Slide = Drawer.CurrentSlide;
+			Ar << bOpen << Slide;
+		}
+
+		int32 NumPickups = Snapshot.DestroyedPickupIds.Num();
+		Ar << NumPickups;
+		for (const FName& PickupId : Snapshot.DestroyedPickupIds)
+		{
+			NameTable.Write(Ar, PickupId);
+		}
+	}
+
+	void ReadWorld(FArchive& Ar, USereneSaveGame& SaveGame, const TArray<FName>& Names)
+	{
+		int32 NumDoors = 0;
+		if (!ReadCount(Ar, NumDoors))
+		{
+			return;
+		}
+		SaveGame.DoorStates.SetNum(NumDoors);
+		for (FSavedDoorState& Door : SaveGame.DoorStates)
+		{
+			uint16 NameIndex = 0;
+			uint8 Flags = 0;
+			Ar << NameIndex << Flags << Door.CurrentAngle;
+			Door.DoorId = ResolveName(Names, NameIndex, Ar);
+			Door.bIsOpen = (Flags & DoorOpen) != 0;
+			Door.bIsLocked = (Flags & DoorLocked) != 0;
+			Door.OpenDirection = (Flags & DoorOpensReverse) ? -1.0f : 1.0f;
+		}
+
+		int32 NumDrawers = 0;
+		if (!ReadCount(Ar, NumDrawers))
+		{
+			return;
+		}
+		SaveGame.DrawerStates.SetNum(NumDrawers);
+		for (FSavedDrawerState& Drawer : SaveGame.DrawerStates)
+		{
+			uint16 NameIndex = 0;
+			uint8 bOpen = 0;
+			Ar << NameIndex << bOpen << Drawer.CurrentSlide;
+			Drawer.DrawerId = ResolveName(Names, NameIndex, Ar);
+			Drawer.bIsOpen = bOpen != 0;
+		}
+
+		int32 NumPickups = 0;
+		if (!ReadCount(Ar, NumPickups))
+		{
+			return;
+		}
+		SaveGame.DestroyedPickupIds.SetNum(NumPickups);
+		for (FName& PickupId : SaveGame.DestroyedPickupIds)
+		{
+			uint16 NameIndex = 0;
+			Ar << NameIndex;
+			PickupId = ResolveName(Names, NameIndex, Ar);
+		}
+	}
+
+	// -----------------------------------------------------------------------
+	// Section framing
+	// -----------------------------------------------------------------------
+
+	struct FPendingSection
+	{
+		FSectionEntry Entry;
+		TArray<uint8> Data;
+	};
+
+	void AddSection(TArray<FPendingSection>& Sections, ESaveSection Id, TArray<uint8>&& Raw, bool bTryCompress)
+	{
+		FPendingSection& Section = Sections.AddDefaulted_GetRef();
+		Section.Entry.Id = static_cast<uint8>(Id);
+		Section.Entry.RawSize = Raw.Num();
+
+		if (bTryCompress && Raw.Num() >= MinCompressSize)
+		{
+			int32 CompressedSize = FCompression::CompressMemoryBound(NAME_Oodle, Raw.Num());
+			TArray<uint8> Compressed;
+			Compressed.SetNumUninitialized(CompressedSize);
+			if (FCompression::CompressMemory(NAME_Oodle, Compressed.GetData(), CompressedSize, Raw.GetData(), Raw.Num())
+				&& CompressedSize < Raw.Num())
+			{
+				Compressed.SetNum(CompressedSize);
+				Section.Entry.Flags |= SectionCompressed;
+				Section.Data = MoveTemp(Compressed);
+			}
+		}
+
+		if (!(Section.Entry.Flags & SectionCompressed))
+		{
+			Section.Data = MoveTemp(Raw);
+		}
+		Section.Entry.StoredSize = Section.Data.Num();
+	}
+
+#if PLATFORM_DESKTOP
+	/** File the generic (desktop) save system uses for SlotName. */
+	FString GetSlotFilePath(const FString& SlotName)
+	{
+		return FPaths::ProjectSavedDir() / TEXT("SaveGames") / (SlotName + TEXT(".sav"));
+	}
+#endif
+
+	// -----------------------------------------------------------------------
+	// Section reading
+	// -----------------------------------------------------------------------
+
+	/**
+	 * Where a reader's bytes come from: an encoded save already in memory, or a
+	 * slot file that is only read at the header, the table and the sections
+	 * asked for. Large sections of a slot file are memory-mapped where the
+	 * platform supports it instead of being copied into a buffer.
+	 */
+	class FSectionSource
+	{
+	public:
+		explicit FSectionSource(const TArray<uint8>& InBytes)
+			: Bytes(&InBytes)
+			, Archive(MakeUnique<FMemoryReader>(InBytes))
+		{
+		}
+
+		explicit FSectionSource(const FString& InPath)
+			: Path(InPath)
+			, Archive(IFileManager::Get().CreateFileReader(*InPath, FILEREAD_Silent))
+		{
+		}
+
+		bool IsOpen() const { return Archive.IsValid(); }
+		FArchive& GetArchive() { return *Archive; }
+		int64 TotalSize() const { return Archive->TotalSize(); }
+
+		/** Stored bytes of an in-bounds section, valid until the next call. nullptr on a read error. */
+		const uint8* GetStored(const FSectionEntry& Entry)
+		{
+			if (Bytes)
+			{
+				return Bytes->GetData() + Entry.Offset;
+			}
+
+			Region.Reset();
+			if (Entry.StoredSize >= MinMappedSectionSize)
+			{
+				if (!bTriedMapping)
+				{
+					bTriedMapping = true;
+					FOpenMappedResult Mapped = FPlatformFileManager::Get().GetPlatformFile().OpenMappedEx(*Path);
+					if (Mapped.HasValue())
+					{
+						MappedFile = Mapped.StealValue();
+					}
+				}
+				if (MappedFile)
+				{
+					Region.Reset(MappedFile->MapRegion(Entry.Offset, Entry.StoredSize));
+					if (Region)
+					{
+						return Region->GetMappedPtr();
+					}
+				}
+			}
+
+			Scratch.SetNumUninitialized(Entry.StoredSize);
+			Archive->Seek(Entry.Offset);
+			Archive->Serialize(Scratch.GetData(), Entry.StoredSize);
+			return Archive->IsError() ? nullptr : Scratch.GetData();
+		}
+
+	private:
+		const TArray<uint8>* Bytes = nullptr;
+		FString Path;
+		TUniquePtr<FArchive> Archive;
+
+		bool bTriedMapping = false;
+		TUniquePtr<IMappedFileHandle> MappedFile;
+		/** Declared after MappedFile: a region must be released before its file handle. */
+		TUniquePtr<IMappedFileRegion> Region;
+		TArray<uint8> Scratch;
+	};
+
+	/** Raw bytes of a section, decompressed if needed. False if the entry is out of bounds or corrupt. */
+	bool ExtractSection(FSectionSource& Source, const FSectionEntry& Entry, TArray<uint8>& OutRaw)
+	{
+		if (Entry.Offset < 0 || Entry.StoredSize < 0 || Entry.RawSize < 0
+			|| static_cast<int64>(Entry.Offset) + Entry.StoredSize > Source.TotalSize())
+		{
+			return false;
+		}
+
+		const uint8* Stored = Source.GetStored(Entry);
+		if (!Stored)
+		{
+			return false;
+		}
+
+		if (!(Entry.Flags & SectionCompressed))
+		{
+			OutRaw.Reset();
+			OutRaw.Append(Stored, Entry.StoredSize);
+			return Entry.StoredSize == Entry.RawSize;
+		}
+
+		OutRaw.SetNumUninitialized(Entry.RawSize);
+		return FCompression::UncompressMemory(NAME_Oodle, OutRaw.GetData(), Entry.RawSize, Stored, Entry.StoredSize);
+	}
+
+	/** Whether Ar starts with the sectioned-format magic. Leaves Ar at the start. */
+	bool HasSaveMagic(FArchive& Ar)
+	{
+		uint32 Magic = 0;
+		if (Ar.TotalSize() >= static_cast<int64>(sizeof(uint32)))
+		{
+			Ar << Magic;
+			Ar.Seek(0);
+		}
+		return !Ar.IsError() && Magic == SaveMagic;
+	}
+
+	/**
+	 * Header and table, then only the sections Parts needs: each is seeked to,
+	 * so skipped sections (typically the thumbnail) are never read.
+	 */
+	USereneSaveGame* ReadSectioned(FSectionSource& Source, ESaveReadParts Parts)
+	{
+		FArchive& Reader = Source.GetArchive();
+		uint32 Magic = 0;
+		int32 Version = 0;
+		int32 NumSections = 0;
+		Reader << Magic << Version << NumSections;
+		if (Reader.IsError() || NumSections < 0 || NumSections > 255)
+		{
+			return nullptr;
+		}
+		if (Version > USereneSaveGame::CurrentSaveVersion)
+		{
+			UE_LOG(LogSerene, Error, TEXT("SaveFileFormat: save is version %d, this build reads up to %d"),
+				Version, USereneSaveGame::CurrentSaveVersion);
+			return nullptr;
+		}
+
+		TArray<FSectionEntry> Table;
+		Table.SetNum(NumSections);
+		for (FSectionEntry& Entry : Table)
+		{
+			Reader << Entry;
+		}
+		if (Reader.IsError())
+		{
+			return nullptr;
+		}
+
+		auto FindSection = [&Table](ESaveSection Id) -> const FSectionEntry*
+		{
+			return Table.FindByPredicate([Id](const FSectionEntry& Entry) { return Entry.Id == static_cast<uint8>(Id); });
+		};
+
+		USereneSaveGame* SaveGame = NewObject<USereneSaveGame>();
+		SaveGame->SaveVersion = Version;
+
+		TArray<uint8> Raw;
+		bool bValid = true;
+
+		if (const FSectionEntry* Meta = FindSection(ESaveSection::Meta))
+		{
+			bValid &= ExtractSection(Source, *Meta, Raw);
+			FMemoryReader Ar(Raw);
+			ReadMeta(Ar, SaveGame->SlotInfo);
+			bValid &= !Ar.IsError();
+		}
+
+		const FSectionEntry* Thumbnail = FindSection(ESaveSection::Thumbnail);
+		if (Thumbnail && EnumHasAnyFlags(Parts, ESaveReadParts::Thumbnail))
+		{
+			bValid &= ExtractSection(Source, *Thumbnail, SaveGame->SlotInfo.ScreenshotData);
+		}
+
+		if (EnumHasAnyFlags(Parts, ESaveReadParts::GameState))
+		{
+			TArray<FName> Names;
+			if (const FSectionEntry* NamesEntry = FindSection(ESaveSection::Names))
+			{
+				bValid &= ExtractSection(Source, *NamesEntry, Raw);
+				FMemoryReader Ar(Raw);
+				int32 NumNames = 0;
+				if (ReadCount(Ar, NumNames))
+				{
+					Names.SetNum(NumNames);
+					for (FName& Name : Names)
+					{
+						Ar << Name;
+					}
+				}
+				bValid &= !Ar.IsError();
+			}
+
+			if (const FSectionEntry* Player = FindSection(ESaveSection::Player))
+			{
+				bValid &= ExtractSection(Source, *Player, Raw);
+				FMemoryReader Ar(Raw);
+				ReadPlayer(Ar, *SaveGame, Names);
+				bValid &= !Ar.IsError();
+			}
+
+			if (const FSectionEntry* World = FindSection(ESaveSection::World))
+			{
+				bValid &= ExtractSection(Source, *World, Raw);
+				FMemoryReader Ar(Raw);
+				ReadWorld(Ar, *SaveGame, Names);
+				bValid &= !Ar.IsError();
+			}
+		}
+
+		if (!bValid)
+		{
+			UE_LOG(LogSerene, Error, TEXT("SaveFileFormat: corrupt save data (%lld bytes)"), Source.TotalSize());
+			return nullptr;
+		}
+
+		return SaveGame;
+	}
+
+	// -----------------------------------------------------------------------
+	// Migration
+	// -----------------------------------------------------------------------
+
+	/**
+	 * SaveVersion 1: UPROPERTY-tagged USaveGame with every door and drawer stored.
+	 * The data is a superset of what version 2 stores (default-state actors restore
+	 * to the state they already have), so migrating only bumps the version; the
+	 * next save of the slot writes the compact form.
+	 *
+	 * The stored SaveVersion is not trusted: tagged serialization skips properties
+	 * equal to the class default, so version 1 files may not contain it at all.
+	 */
+	USereneSaveGame* ReadLegacy(const TArray<uint8>& Bytes)
+	{
+		USereneSaveGame* SaveGame = Cast<USereneSaveGame>(UGameplayStatics::LoadGameFromMemory(Bytes));
+		if (!SaveGame)
+		{
+			return nullptr;
+		}
+
+		UE_LOG(LogSerene, Log, TEXT("SaveFileFormat: migrating SaveVersion 1 save (%d doors, %d drawers)"),
+			SaveGame->DoorStates.Num(), SaveGame->DrawerStates.Num());
+		SaveGame->SaveVersion = USereneSaveGame::CurrentSaveVersion;
+		return SaveGame;
+	}
+}
+
+// ---------------------------------------------------------------------------
+// Write
+// ---------------------------------------------------------------------------
+
+bool FSaveFileFormat::Write(const FSaveSnapshot& Snapshot, TArray<uint8>& OutBytes)
+{
+	OutBytes.Reset();
+
+	FNameTableWriter NameTable;
+	TArray<FPendingSection> Sections;
+
+	{
+		TArray<uint8> Raw;
+		FMemoryWriter Ar(Raw);
+		WriteMeta(Ar, Snapshot.SlotInfo);
+		AddSection(Sections, ESaveSection::Meta, MoveTemp(Raw), false);
+	}
+
+	if (Snapshot.SlotInfo.ScreenshotData.Num() > 0)
+	{
+		TArray<uint8> Raw = Snapshot.SlotInfo.ScreenshotData;
+		AddSection(Sections, ESaveSection::Thumbnail, MoveTemp(Raw), false);
+	}
+
+	// Player and World fill the name table, so they are encoded before Names but stored after it.
+	bool bNameTableFull = false;
+
+	TArray<uint8> PlayerRaw;
+	{
+		FMemoryWriter Ar(PlayerRaw);
+		WritePlayer(Ar, Snapshot, NameTable);
+		bNameTableFull |= Ar.IsError();
+	}
+
+	TArray<uint8> WorldRaw;
+	{
+		FMemoryWriter Ar(WorldRaw);
+		WriteWorld(Ar, Snapshot, NameTable);
+		bNameTableFull |= Ar.IsError();
+	}
+
+	if (bNameTableFull)
+	{
+		UE_LOG(LogSerene, Error, TEXT("SaveFileFormat: more than %d distinct names -- save not encoded"), MAX_uint16);
+		return false;
+	}
+
+	{
+		TArray<uint8> Raw;
+		FMemoryWriter Ar(Raw);
+		int32 NumNames = NameTable.Names.Num();
+		Ar << NumNames;
+		for (FName& Name : NameTable.Names)
+		{
+			Ar << Name;
+		}
+		AddSection(Sections, ESaveSection::Names, MoveTemp(Raw), true);
+	}
+
+	AddSection(Sections, ESaveSection::Player, MoveTemp(PlayerRaw), true);
+	AddSection(Sections, ESaveSection::World, MoveTemp(WorldRaw), true);
+
+	// Header + table size is fixed once the section count is known.
+	FMemoryWriter Writer(OutBytes);
+
+	uint32 Magic = SaveMagic;
+	int32 Version = USereneSaveGame::CurrentSaveVersion;
+	int32 NumSections = Sections.Num();
+	Writer << Magic << Version << NumSections;
+
+	const int64 TableStart = Writer.Tell();
+	for (FPendingSection& Section : Sections)
+	{
+		Writer << Section.Entry;
+	}
+
+	int32 Offset = static_cast<int32>(Writer.Tell());
+	for (FPendingSection& Section : Sections)
+	{
+		Section.Entry.Offset = Offset;
+		Offset += Section.Entry.StoredSize;
+	}
+
+	Writer.Seek(TableStart);
+	for (FPendingSection& Section : Sections)
+	{
+		Writer << Section.Entry;
+	}
+
+	for (const FPendingSection& Section : Sections)
+	{
+		Writer.Serialize(const_cast<uint8*>(Section.Data.GetData()), Section.Data.Num());
+	}
+	return true;
+}
+
+bool FSaveFileFormat::WriteToSlot(const TArray<uint8>& Bytes, const FString& SlotName)
+{
+#if PLATFORM_DESKTOP
+	// Same file the generic save system reads (Saved/SaveGames/<Slot>.sav), but written beside it
+	// and renamed over it, so a crash mid-write leaves the previous save intact.
+	const FString FinalPath = GetSlotFilePath(SlotName);
+	const FString TempPath = FinalPath + TEXT(".tmp");
+
+	if (FFileHelper::SaveArrayToFile(Bytes, *TempPath)
+		&& IFileManager::Get().Move(*FinalPath, *TempPath, /*bReplace=*/ true, /*bEvenIfReadOnly=*/ true))
+	{
+		return true;
+	}
+
+	IFileManager::Get().Delete(*TempPath, /*bRequireExists=*/ false, /*bEvenReadOnly=*/ true, /*bQuiet=*/ true);
+	return false;
+#else
+	return UGameplayStatics::SaveDataToSlot(Bytes, SlotName, 0);
+#endif
+}
+
+// ---------------------------------------------------------------------------
+// Read
+// ---------------------------------------------------------------------------
+
+USereneSaveGame* FSaveFileFormat::Read(const TArray<uint8>& Bytes, ESaveReadParts Parts)
+{
+	FSectionSource Source(Bytes);
+	if (!HasSaveMagic(Source.GetArchive()))
+	{
+		return ReadLegacy(Bytes);
+	}
+	return ReadSectioned(Source, Parts);
+}
+
+USereneSaveGame* FSaveFileFormat::ReadFromSlot(const FString& SlotName, ESaveReadParts Parts)
+{
+#if PLATFORM_DESKTOP
+	const FString Path = GetSlotFilePath(SlotName);
+	FSectionSource Source(Path);
+	if (!Source.IsOpen())
+	{
+		return nullptr;
+	}
+	if (HasSaveMagic(Source.GetArchive()))
+	{
+		return ReadSectioned(Source, Parts);
+	}
+
+	// SaveVersion 1 is one tagged blob; it has no sections to pick from.
+	TArray<uint8> Bytes;
+	return FFileHelper::LoadFileToArray(Bytes, *Path, FILEREAD_Silent) ? ReadLegacy(Bytes) : nullptr;
+#else
+	// Console save systems hand back the whole slot; sections are still only decoded as asked.
+	TArray<uint8> Bytes;
+	return UGameplayStatics::LoadDataFromSlot(Bytes, SlotName, 0) ? Read(Bytes, Parts) : nullptr;
+#endif
+}
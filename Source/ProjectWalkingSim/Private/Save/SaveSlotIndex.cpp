@@ -0,0 +1,222 @@
+// Copyright Null Lantern.
+
+#include "Save/SaveSlotIndex.h"
+#include "Kismet/GameplayStatics.h"
+#include "Misc/Crc.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Core/SereneLogChannels.h"
+
+namespace
+{
+	/** 'SIDX' */
+	constexpr uint32 IndexMagic = 0x58444953;
+	/** 2: thumbnails moved out of the index into the saves' own Thumbnail sections. */
+	constexpr uint32 IndexVersion = 2;
+	constexpr int32 NumCopies = 2;
+}
+
+FSaveSlotIndex::FSaveSlotIndex(int32 InNumSlots)
+{
+	Entries.SetNum(InNumSlots);
+}
+
+FString FSaveSlotIndex::GetCopySlotName(int32 CopyIndex)
+{
+	return FString::Printf(TEXT("SaveIndex_%d"), CopyIndex);
+}
+
+// ---------------------------------------------------------------------------
+// Queries
+// ---------------------------------------------------------------------------
+
+bool FSaveSlotIndex::IsOccupied(int32 SlotIndex) const
+{
+	return Entries.IsValidIndex(SlotIndex) && Entries[SlotIndex].bOccupied;
+}
+
+const FSaveSlotInfo* FSaveSlotIndex::GetInfo(int32 SlotIndex) const
+{
+	return IsOccupied(SlotIndex) ? &Entries[SlotIndex].Info : nullptr;
+}
+
+void FSaveSlotIndex::SetEntry(int32 SlotIndex, const FSaveSlotInfo& Info)
+{
+	if (Entries.IsValidIndex(SlotIndex))
+	{
+		Entries[SlotIndex].bOccupied = true;
+		Entries[SlotIndex].Info = Info;
+		Entries[SlotIndex].Info.ScreenshotData.Empty();
+	}
+}
+
+void FSaveSlotIndex::ClearEntry(int32 SlotIndex)
+{
+	if (Entries.IsValidIndex(SlotIndex))
+	{
+		Entries[SlotIndex] = FEntry();
+	}
+}
+
+int32 FSaveSlotIndex::GetLatestSlot() const
+{
+	int32 LatestSlot = -1;
+	FDateTime LatestTimestamp = FDateTime::MinValue();
+
+	for (int32 i = 0; i < Entries.Num(); ++i)
+	{
+		if (Entries[i].bOccupied && Entries[i].Info.Timestamp > LatestTimestamp)
+		{
+			LatestTimestamp = Entries[i].Info.Timestamp;
+			LatestSlot = i;
+		}
+	}
+
+	return LatestSlot;
+}
+
+bool FSaveSlotIndex::HasAnyOccupied() const
+{
+	return Entries.ContainsByPredicate([](const FEntry& Entry) { return Entry.bOccupied; });
+}
+
+// ---------------------------------------------------------------------------
+// Disk I/O
+// ---------------------------------------------------------------------------
+
+bool FSaveSlotIndex::Load()
+{
+	bool bLoaded = false;
+	uint32 BestGeneration = 0;
+	TArray<FEntry> BestEntries;
+
+	for (int32 Copy = 0; Copy < NumCopies; ++Copy)
+	{
+		TArray<uint8> Bytes;
+		if (!UGameplayStatics::LoadDataFromSlot(Bytes, GetCopySlotName(Copy), 0))
+		{
+			continue;
+		}
+
+		uint32 CopyGeneration = 0;
+		if (!SerializeFromBytes(Bytes, CopyGeneration))
+		{
+			UE_LOG(LogSerene, Warning, TEXT("SaveSlotIndex: %s is corrupt, ignoring"), *GetCopySlotName(Copy));
+			continue;
+		}
+
+		if (!bLoaded || CopyGeneration > BestGeneration)
+		{
+			bLoaded = true;
+			BestGeneration = CopyGeneration;
+			BestEntries = Entries;
+		}
+	}
+
+	if (bLoaded)
+	{
+		Entries = MoveTemp(BestEntries);
+		Generation = BestGeneration;
+		UE_LOG(LogSerene, Log, TEXT("SaveSlotIndex: loaded generation %u"), Generation);
+	}
+	else
+	{
+		for (FEntry& Entry : Entries)
+		{
+			Entry = FEntry();
+		}
+	}
+
+	return bLoaded;
+}
+
+bool FSaveSlotIndex::Write()
+{
+	++Generation;
+
+	TArray<uint8> Bytes;
+	SerializeToBytes(Bytes);
+
+	// Overwrite the older copy; the newer one stays valid until this write completes.
+	const FString SlotName = GetCopySlotName(Generation % NumCopies);
+	const bool bSuccess = UGameplayStatics::SaveDataToSlot(Bytes, SlotName, 0);
+
+	UE_LOG(LogSerene, Log, TEXT("SaveSlotIndex: %s generation %u to %s (%d bytes)"),
+		bSuccess ? TEXT("wrote") : TEXT("FAILED to write"), Generation, *SlotName, Bytes.Num());
+	return bSuccess;
+}
+
+void FSaveSlotIndex::SerializeToBytes(TArray<uint8>& OutBytes) const
+{
+	FMemoryWriter Writer(OutBytes);
+
+	uint32 Magic = IndexMagic;
+	uint32 Version = IndexVersion;
+	uint32 WrittenGeneration = Generation;
+	int32 NumSlots = Entries.Num();
+	Writer << Magic << Version << WrittenGeneration << NumSlots;
+
+	for (const FEntry& Entry : Entries)
+	{
+		bool bOccupied = Entry.bOccupied;
+		int64 Ticks = Entry.Info.Timestamp.GetTicks();
+		FString MapName = Entry.Info.MapName;
+		int32 InventoryItemCount = Entry.Info.InventoryItemCount;
+		int32 Width = Entry.Info.ScreenshotWidth;
+		int32 Height = Entry.Info.ScreenshotHeight;
+		Writer << bOccupied << Ticks << MapName << InventoryItemCount << Width << Height;
+	}
+
+	uint32 Crc = FCrc::MemCrc32(OutBytes.GetData(), OutBytes.Num());
+	Writer << Crc;
+}
+
+bool FSaveSlotIndex::SerializeFromBytes(const TArray<uint8>& Bytes, uint32& OutGeneration)
+{
+	if (Bytes.Num() < static_cast<int32>(sizeof(uint32)) * 5)
+	{
+		return false;
+	}
+
+	const int32 PayloadSize = Bytes.Num() - static_cast<int32>(sizeof(uint32));
+	uint32 StoredCrc = 0;
+	FMemory::Memcpy(&StoredCrc, Bytes.GetData() + PayloadSize, sizeof(uint32));
+	if (StoredCrc != FCrc::MemCrc32(Bytes.GetData(), PayloadSize))
+	{
+		return false;
+	}
+
+	FMemoryReader Reader(Bytes);
+
+	uint32 Magic = 0;
+	uint32 Version = 0;
+	int32 NumSlots = 0;
+	Reader << Magic << Version << OutGeneration << NumSlots;
+	if (Magic != IndexMagic || Version != IndexVersion || NumSlots < 0)
+	{
+		return false;
+	}
+
+	// Slots beyond our count (index from a build with more slots) are read and dropped.
+	TArray<FEntry> Loaded;
+	Loaded.SetNum(NumSlots);
+	for (int32 i = 0; i < NumSlots; ++i)
+	{
+		FEntry& Entry = Loaded[i];
+		int64 Ticks = 0;
+		Reader << Entry.bOccupied << Ticks << Entry.Info.MapName << Entry.Info.InventoryItemCount
+			<< Entry.Info.ScreenshotWidth << Entry.Info.ScreenshotHeight;
+		Entry.Info.Timestamp = FDateTime(Ticks);
+	}
+
+	if (Reader.IsError())
+	{
+		return false;
+	}
+
+	for (int32 i = 0; i < Entries.Num(); ++i)
+	{
+		Entries[i] = Loaded.IsValidIndex(i) ? MoveTemp(Loaded[i]) : FEntry();
+	}
+	return true;
+}
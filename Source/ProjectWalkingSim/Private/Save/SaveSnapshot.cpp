@@ -0,0 +1,26 @@
+// Copyright Null Lantern.
+
+#include "Save/SaveSnapshot.h"
+#include "Save/SereneSaveGame.h"
+
+void FSaveSnapshot::CopyFrom(const USereneSaveGame& SaveGame)
+{
+	SlotInfo = SaveGame.SlotInfo;
+	PlayerLocation = SaveGame.PlayerLocation;
+	PlayerRotation = SaveGame.PlayerRotation;
+	InventorySlots = SaveGame.InventorySlots;
+	DoorStates = SaveGame.DoorStates;
+	DrawerStates = SaveGame.DrawerStates;
+	DestroyedPickupIds = SaveGame.DestroyedPickupIds;
+}
+
+void FSaveSnapshot::CopyTo(USereneSaveGame& SaveGame) const
+{
+	SaveGame.SlotInfo = SlotInfo;
+	SaveGame.PlayerLocation = PlayerLocation;
+	SaveGame.PlayerRotation = PlayerRotation;
+	SaveGame.InventorySlots = InventorySlots;
+	SaveGame.DoorStates = DoorStates;
+	SaveGame.DrawerStates = DrawerStates;
+	SaveGame.DestroyedPickupIds = DestroyedPickupIds;
+}
@@ -2,23 +2,47 @@
 
 #include "Save/SaveSubsystem.h"
 #include "Save/SereneSaveGame.h"
+#include "Save/SaveFileFormat.h"
+#include "Save/SaveableRegistrySubsystem.h"
+#include "Save/LevelResetSubsystem.h"
 #include "Core/SereneLogChannels.h"
-#include "Interaction/DoorActor.h"
-#include "Interaction/DrawerActor.h"
-#include "Interaction/PickupActor.h"
-#include "Interaction/SaveableInterface.h"
+#include "Core/SereneGameMode.h"
+#include "AI/WendigoCharacter.h"
+#include "Hiding/HidingComponent.h"
 #include "Player/SereneCharacter.h"
 #include "Inventory/InventoryComponent.h"
+#include "EngineUtils.h"
+#include "TimerManager.h"
+#include "HAL/IConsoleManager.h"
 #include "Kismet/GameplayStatics.h"
 #include "Engine/GameViewportClient.h"
 #include "UnrealClient.h"
 #include "ImageUtils.h"
-#include "EngineUtils.h"
+#include "ImageCore.h"
+#include "Engine/Texture2D.h"
+#include "Async/Async.h"
+#include "UObject/GarbageCollection.h"
+
+static TAutoConsoleVariable<float> CVarCheckpointInterval(
+	TEXT("Serene.Save.CheckpointInterval"),
+	90.0f,
+	TEXT("Seconds between timed checkpoints (skipped while unsafe, e.g. during a chase). 0 disables timed checkpoints."),
+	ECVF_Default);
 
 void USaveSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
 	Super::Initialize(Collection);
 
+	ThumbnailStates.SetNum(MaxSlots);
+	ThumbnailTextures.SetNum(MaxSlots);
+
+	if (!SaveIndex.Load())
+	{
+		RebuildSaveIndex();
+	}
+
+	Checkpoints.SetNum(MaxCheckpoints);
+
 	UE_LOG(LogSerene, Log, TEXT("SaveSubsystem initialized with %d slots"), MaxSlots);
 }
 
@@ -31,6 +55,13 @@ void USaveSubsystem::Deinitialize()
 		ScreenshotDelegateHandle.Reset();
 	}
 
+	Checkpoints.Empty();
+	NumCheckpoints = 0;
+
+	// In-flight decodes check the serial and find no entry.
+	ThumbnailStates.Empty();
+	ThumbnailTextures.Empty();
+
 	Super::Deinitialize();
 }
 
@@ -46,6 +77,14 @@ void USaveSubsystem::SaveToSlot(int32 SlotIndex)
 		return;
 	}
 
+	// One save at a time: two writes to a slot would share its temp file, and index updates must land in order.
+	if (InFlightSaveSlotIndex >= 0)
+	{
+		UE_LOG(LogSerene, Warning, TEXT("SaveToSlot: save to slot %d still in progress, slot %d not saved"),
+			InFlightSaveSlotIndex, SlotIndex);
+		return;
+	}
+
 	UWorld* World = GetWorld();
 	if (!World)
 	{
@@ -53,24 +92,19 @@ void USaveSubsystem::SaveToSlot(int32 SlotIndex)
 		return;
 	}
 
-	// Create save game object and begin populating it
-	USereneSaveGame* SaveGame = NewObject<USereneSaveGame>(this);
-	SaveGame->SlotInfo.Timestamp = FDateTime::Now();
-
-	// Gather world + player state synchronously
-	GatherWorldState(SaveGame, World);
-	GatherPlayerState(SaveGame, World);
+	// One plain-value capture pass; everything after the screenshot runs on a worker
+	const double StartTime = FPlatformTime::Seconds();
+	CaptureSnapshot(PendingSaveSnapshot, World, /*bUseSaveLocation=*/ true);
+	PendingSaveSlotIndex = SlotIndex;
+	InFlightSaveSlotIndex = SlotIndex;
 
-	// Store destroyed pickup tracking data
-	SaveGame->DestroyedPickupIds.Reserve(DestroyedPickupTracker.Num());
-	for (const FName& Id : DestroyedPickupTracker)
+	// A save is also the newest point to retry from
+	if (FSaveSnapshot* Checkpoint = AddCheckpoint(TEXT("Save"), World->GetTimeSeconds()))
 	{
-		SaveGame->DestroyedPickupIds.Add(Id);
+		*Checkpoint = PendingSaveSnapshot;
 	}
 
-	// Store pending save state for screenshot callback
-	PendingSaveObject = SaveGame;
-	PendingSaveSlotIndex = SlotIndex;
+	UE_LOG(LogSerene, Log, TEXT("SaveToSlot: state captured in %.3f ms"), (FPlatformTime::Seconds() - StartTime) * 1000.0);
 
 	// Unbind any existing screenshot delegate
 	if (ScreenshotDelegateHandle.IsValid())
@@ -97,6 +131,12 @@ void USaveSubsystem::LoadFromSlot(int32 SlotIndex)
 		return;
 	}
 
+	if (PendingLoadState != EPendingLoadState::None)
+	{
+		UE_LOG(LogSerene, Warning, TEXT("LoadFromSlot: a load is already in progress"));
+		return;
+	}
+
 	const FString SlotName = GetSlotName(SlotIndex);
 
 	if (!UGameplayStatics::DoesSaveGameExist(SlotName, 0))
@@ -105,20 +145,90 @@ void USaveSubsystem::LoadFromSlot(int32 SlotIndex)
 		return;
 	}
 
-	PendingSaveData = Cast<USereneSaveGame>(
-		UGameplayStatics::LoadGameFromSlot(SlotName, 0));
+	// Same map: restore in place instead of reloading it
+	UWorld* World = GetWorld();
+	const FSaveSlotInfo* Info = SaveIndex.GetInfo(SlotIndex);
+	const ULevelResetSubsystem* LevelReset = World ? World->GetSubsystem<ULevelResetSubsystem>() : nullptr;
+	bPendingLoadInPlace = LevelReset && LevelReset->CanResetInPlace()
+		&& Info && Info->MapName == UGameplayStatics::GetCurrentLevelName(World);
+
+	PendingLoadState = EPendingLoadState::Loading;
+	PendingSaveData = nullptr;
+	PendingApplyWorld = bPendingLoadInPlace ? World : nullptr;
+	const uint32 LoadSerial = ++PendingLoadSerial;
 
-	if (!PendingSaveData)
+	// Read + deserialize on a worker while the game keeps running; the level is only left once the save is known good.
+	AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask,
+		[WeakThis = TWeakObjectPtr<USaveSubsystem>(this), SlotName, LoadSerial, SlotIndex]()
+	{
+		USereneSaveGame* Loaded = nullptr;
+		{
+			// The save object exists only on this thread until handed over: hold off GC while
+			// creating it, then root it until the game thread owns it via PendingSaveData.
+			// Only the sections the restore needs are read; the thumbnail stays on disk.
+			FGCScopeGuard GCGuard;
+			Loaded = FSaveFileFormat::ReadFromSlot(SlotName, ESaveReadParts::GameState);
+			if (Loaded)
+			{
+				Loaded->AddToRoot();
+			}
+		}
+
+		AsyncTask(ENamedThreads::GameThread, [WeakThis, Loaded, LoadSerial, SlotIndex]()
+		{
+			if (Loaded)
+			{
+				Loaded->RemoveFromRoot();
+			}
+
+			if (USaveSubsystem* Self = WeakThis.Get())
+			{
+				Self->OnPendingLoadFinished(Loaded, LoadSerial, SlotIndex);
+			}
+		});
+	});
+
+	UE_LOG(LogSerene, Log, TEXT("LoadFromSlot: reading slot %d in the background, then %s"), SlotIndex,
+		bPendingLoadInPlace ? TEXT("restoring in place") : TEXT("restarting level"));
+}
+
+void USaveSubsystem::OnPendingLoadFinished(USereneSaveGame* Loaded, uint32 LoadSerial, int32 SlotIndex)
+{
+	if (LoadSerial != PendingLoadSerial || PendingLoadState != EPendingLoadState::Loading)
 	{
-		UE_LOG(LogSerene, Error, TEXT("LoadFromSlot: failed to load save from slot %d (%s)"), SlotIndex, *SlotName);
 		return;
 	}
 
-	UE_LOG(LogSerene, Log, TEXT("LoadFromSlot: loaded save from slot %d, restarting level"), SlotIndex);
+	if (!Loaded)
+	{
+		UE_LOG(LogSerene, Error, TEXT("LoadFromSlot: failed to read or deserialize slot %d -- current level kept"), SlotIndex);
+		PendingLoadState = EPendingLoadState::None;
+		bPendingLoadInPlace = false;
+		PendingApplyWorld = nullptr;
+		OnSlotLoadFailed.Broadcast(SlotIndex);
+		return;
+	}
 
-	// Restart the level -- world resets to map defaults
-	UWorld* World = GetWorld();
-	if (World)
+	PendingSaveData = Loaded;
+	PendingLoadState = EPendingLoadState::Ready;
+
+	// The load is going ahead: earlier checkpoints belong to the session being left
+	NumCheckpoints = 0;
+
+	UE_LOG(LogSerene, Log, TEXT("LoadFromSlot: save deserialized"));
+
+	if (bPendingLoadInPlace)
+	{
+		if (UWorld* World = PendingApplyWorld.Get())
+		{
+			PendingApplyWorld = nullptr;
+			ApplyPendingSaveData(World);
+		}
+		return;
+	}
+
+	// Restart the level -- world resets to map defaults, GameMode applies the data once actors are ready
+	if (UWorld* World = GetWorld())
 	{
 		FString MapName = World->GetMapName();
 		MapName.RemoveFromStart(World->StreamingLevelsPrefix);
@@ -126,6 +236,28 @@ void USaveSubsystem::LoadFromSlot(int32 SlotIndex)
 	}
 }
 
+void USaveSubsystem::RestartLevel()
+{
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	// Starting over: earlier checkpoints are progress the player chose to discard
+	NumCheckpoints = 0;
+
+	ULevelResetSubsystem* LevelReset = World->GetSubsystem<ULevelResetSubsystem>();
+	if (LevelReset && LevelReset->CanResetInPlace() && PendingLoadState == EPendingLoadState::None)
+	{
+		LevelReset->ResetToLevelStart();
+		DestroyedPickupTracker.Empty();
+		return;
+	}
+
+	UGameplayStatics::OpenLevel(World, FName(*UGameplayStatics::GetCurrentLevelName(World)));
+}
+
 void USaveSubsystem::LoadLatestSave()
 {
 	const int32 LatestSlot = GetLatestSlotIndex();
@@ -140,183 +272,404 @@ void USaveSubsystem::LoadLatestSave()
 
 bool USaveSubsystem::HasAnySave() const
 {
-	for (int32 i = 0; i < MaxSlots; ++i)
-	{
-		if (UGameplayStatics::DoesSaveGameExist(GetSlotName(i), 0))
-		{
-			return true;
-		}
-	}
-	return false;
+	return SaveIndex.HasAnyOccupied();
 }
 
 FSaveSlotInfo USaveSubsystem::GetSlotInfo(int32 SlotIndex) const
+{
+	const FSaveSlotInfo* Info = SaveIndex.GetInfo(SlotIndex);
+	return Info ? *Info : FSaveSlotInfo();
+}
+
+void USaveSubsystem::DeleteSlot(int32 SlotIndex)
 {
 	if (SlotIndex < 0 || SlotIndex >= MaxSlots)
 	{
-		return FSaveSlotInfo();
+		UE_LOG(LogSerene, Warning, TEXT("DeleteSlot: invalid slot index %d"), SlotIndex);
+		return;
+	}
+
+	// The in-flight save would recreate the file and index entry right after the delete.
+	if (SlotIndex == InFlightSaveSlotIndex)
+	{
+		UE_LOG(LogSerene, Warning, TEXT("DeleteSlot: slot %d is being saved, not deleted"), SlotIndex);
+		return;
 	}
 
 	const FString SlotName = GetSlotName(SlotIndex);
-	if (!UGameplayStatics::DoesSaveGameExist(SlotName, 0))
+	if (UGameplayStatics::DoesSaveGameExist(SlotName, 0))
 	{
-		return FSaveSlotInfo();
+		UGameplayStatics::DeleteGameInSlot(SlotName, 0);
+		UE_LOG(LogSerene, Log, TEXT("DeleteSlot: deleted slot %d (%s)"), SlotIndex, *SlotName);
 	}
 
-	const USereneSaveGame* SaveGame = Cast<USereneSaveGame>(
-		UGameplayStatics::LoadGameFromSlot(SlotName, 0));
+	if (SaveIndex.IsOccupied(SlotIndex))
+	{
+		SaveIndex.ClearEntry(SlotIndex);
+		SaveIndex.Write();
+	}
+
+	InvalidateThumbnail(SlotIndex);
+}
 
-	if (!SaveGame)
+bool USaveSubsystem::DoesSaveExist(int32 SlotIndex) const
+{
+	return SaveIndex.IsOccupied(SlotIndex);
+}
+
+int32 USaveSubsystem::GetLatestSlotIndex() const
+{
+	return SaveIndex.GetLatestSlot();
+}
+
+// ---------------------------------------------------------------------------
+// Thumbnail Cache
+// ---------------------------------------------------------------------------
+
+UTexture2D* USaveSubsystem::GetSlotThumbnail(int32 SlotIndex)
+{
+	const FSaveSlotInfo* Info = SaveIndex.GetInfo(SlotIndex);
+	if (!Info || Info->ScreenshotWidth <= 0 || !ThumbnailStates.IsValidIndex(SlotIndex))
+	{
+		return nullptr;
+	}
+
+	FThumbnailState& State = ThumbnailStates[SlotIndex];
+	if (State.Timestamp == Info->Timestamp)
 	{
-		return FSaveSlotInfo();
+		// Decoded, decoding, or failed for this save -- never decoded twice.
+		return ThumbnailTextures[SlotIndex];
 	}
 
-	return SaveGame->SlotInfo;
+	InvalidateThumbnail(SlotIndex);
+	State.Timestamp = Info->Timestamp;
+	State.DecodeSerial = ++LastThumbnailSerial;
+
+	// The JPEG is not in the index: read the save's Thumbnail section and decode it on a worker;
+	// only texture creation (one mip copy) happens on the game thread.
+	AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask,
+		[WeakThis = TWeakObjectPtr<USaveSubsystem>(this), SlotIndex, DecodeSerial = State.DecodeSerial,
+		SlotName = GetSlotName(SlotIndex)]()
+	{
+		TArray<uint8> Jpeg;
+		{
+			// The save object never leaves this scope; only its bytes are kept.
+			FGCScopeGuard GCGuard;
+			if (USereneSaveGame* SaveGame = FSaveFileFormat::ReadFromSlot(SlotName, ESaveReadParts::Thumbnail))
+			{
+				Jpeg = MoveTemp(SaveGame->SlotInfo.ScreenshotData);
+			}
+		}
+
+		FImage Image;
+		const bool bDecoded = Jpeg.Num() > 0 && FImageUtils::DecompressImage(Jpeg.GetData(), Jpeg.Num(), Image);
+
+		AsyncTask(ENamedThreads::GameThread, [WeakThis, SlotIndex, DecodeSerial, bDecoded, Image = MoveTemp(Image)]()
+		{
+			if (USaveSubsystem* Self = WeakThis.Get())
+			{
+				Self->OnThumbnailDecoded(SlotIndex, DecodeSerial, bDecoded ? &Image : nullptr);
+			}
+		});
+	});
+
+	return nullptr;
 }
 
-void USaveSubsystem::DeleteSlot(int32 SlotIndex)
+void USaveSubsystem::InvalidateThumbnail(int32 SlotIndex)
 {
-	if (SlotIndex < 0 || SlotIndex >= MaxSlots)
+	if (ThumbnailStates.IsValidIndex(SlotIndex))
+	{
+		ThumbnailStates[SlotIndex] = FThumbnailState();
+		ThumbnailTextures[SlotIndex] = nullptr;
+	}
+}
+
+void USaveSubsystem::OnThumbnailDecoded(int32 SlotIndex, uint32 DecodeSerial, const FImage* Image)
+{
+	if (!ThumbnailStates.IsValidIndex(SlotIndex) || ThumbnailStates[SlotIndex].DecodeSerial != DecodeSerial)
 	{
-		UE_LOG(LogSerene, Warning, TEXT("DeleteSlot: invalid slot index %d"), SlotIndex);
 		return;
 	}
+	ThumbnailStates[SlotIndex].DecodeSerial = 0;
 
-	const FString SlotName = GetSlotName(SlotIndex);
-	if (UGameplayStatics::DoesSaveGameExist(SlotName, 0))
+	UTexture2D* Texture = Image ? FImageUtils::CreateTexture2DFromImage(*Image) : nullptr;
+	if (!Texture)
 	{
-		UGameplayStatics::DeleteGameInSlot(SlotName, 0);
-		UE_LOG(LogSerene, Log, TEXT("DeleteSlot: deleted slot %d (%s)"), SlotIndex, *SlotName);
+		UE_LOG(LogSerene, Warning, TEXT("GetSlotThumbnail: failed to decode thumbnail for slot %d"), SlotIndex);
+		return;
 	}
+
+	ThumbnailTextures[SlotIndex] = Texture;
+	OnSlotThumbnailReady.Broadcast(SlotIndex, Texture);
 }
 
-bool USaveSubsystem::DoesSaveExist(int32 SlotIndex) const
+// ---------------------------------------------------------------------------
+// Checkpoints
+// ---------------------------------------------------------------------------
+
+void USaveSubsystem::CaptureCheckpoint(FName Reason)
 {
-	if (SlotIndex < 0 || SlotIndex >= MaxSlots)
+	UWorld* World = GetWorld();
+	if (!World || !CanCaptureCheckpoint(World))
+	{
+		UE_LOG(LogSerene, Verbose, TEXT("CaptureCheckpoint: %s skipped (unsafe)"), *Reason.ToString());
+		return;
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	// Same capture as a save, straight into the ring entry; no thumbnail, no encoding.
+	FSaveSnapshot* Snapshot = AddCheckpoint(Reason, World->GetTimeSeconds());
+	if (!Snapshot)
+	{
+		return;
+	}
+	CaptureSnapshot(*Snapshot, World, /*bUseSaveLocation=*/ false);
+
+	UE_LOG(LogSerene, Log, TEXT("CaptureCheckpoint: %s captured in %.3f ms (%d doors, %d drawers)"),
+		*Reason.ToString(), (FPlatformTime::Seconds() - StartTime) * 1000.0,
+		Snapshot->DoorStates.Num(), Snapshot->DrawerStates.Num());
+}
+
+bool USaveSubsystem::HasCheckpoint() const
+{
+	UWorld* World = GetWorld();
+	const FCheckpoint* Latest = GetLatestCheckpoint();
+	const ULevelResetSubsystem* LevelReset = World ? World->GetSubsystem<ULevelResetSubsystem>() : nullptr;
+
+	return Latest && LevelReset && LevelReset->CanResetInPlace()
+		&& PendingLoadState == EPendingLoadState::None
+		&& Latest->Snapshot.SlotInfo.MapName == UGameplayStatics::GetCurrentLevelName(World);
+}
+
+bool USaveSubsystem::RetryFromCheckpoint()
+{
+	if (!HasCheckpoint())
 	{
+		UE_LOG(LogSerene, Warning, TEXT("RetryFromCheckpoint: no checkpoint for this level"));
 		return false;
 	}
-	return UGameplayStatics::DoesSaveGameExist(GetSlotName(SlotIndex), 0);
+
+	const double StartTime = FPlatformTime::Seconds();
+	const FCheckpoint& Checkpoint = *GetLatestCheckpoint();
+
+	// ISaveable reads from a save object
+	USereneSaveGame* SaveGame = NewObject<USereneSaveGame>(this);
+	Checkpoint.Snapshot.CopyTo(*SaveGame);
+
+	ApplySaveData(GetWorld(), SaveGame, /*bResetFirst=*/ true);
+
+	UE_LOG(LogSerene, Log, TEXT("RetryFromCheckpoint: restored %s checkpoint in %.2f ms"),
+		*Checkpoint.Reason.ToString(), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+	return true;
 }
 
-int32 USaveSubsystem::GetLatestSlotIndex() const
+void USaveSubsystem::StartCheckpointTimer(UWorld* World)
 {
-	int32 LatestSlot = -1;
-	FDateTime LatestTimestamp = FDateTime::MinValue();
+	const float Interval = CVarCheckpointInterval.GetValueOnGameThread();
+	if (!World || Interval <= 0.0f)
+	{
+		return;
+	}
 
-	for (int32 i = 0; i < MaxSlots; ++i)
+	// Timer lives in the world, so it stops with it and does not run while paused.
+	World->GetTimerManager().SetTimer(CheckpointTimerHandle, this, &USaveSubsystem::OnCheckpointTimer, Interval, true);
+}
+
+void USaveSubsystem::OnCheckpointTimer()
+{
+	UWorld* World = GetWorld();
+	const float Interval = CVarCheckpointInterval.GetValueOnGameThread();
+	if (!World || Interval <= 0.0f)
 	{
-		const FString SlotName = GetSlotName(i);
-		if (!UGameplayStatics::DoesSaveGameExist(SlotName, 0))
-		{
-			continue;
-		}
+		return;
+	}
 
-		const USereneSaveGame* SaveGame = Cast<USereneSaveGame>(
-			UGameplayStatics::LoadGameFromSlot(SlotName, 0));
+	// A narrative trigger or save captured recently enough.
+	const FCheckpoint* Latest = GetLatestCheckpoint();
+	const float Age = Latest ? World->GetTimeSeconds() - Latest->WorldTime : Interval;
+	if (Latest && Age >= 0.0f && Age < Interval * 0.5f)
+	{
+		return;
+	}
+
+	CaptureCheckpoint(TEXT("Timer"));
+}
 
-		if (SaveGame && SaveGame->SlotInfo.Timestamp > LatestTimestamp)
+bool USaveSubsystem::CanCaptureCheckpoint(UWorld* World) const
+{
+	if (bApplyingSaveData || PendingLoadState != EPendingLoadState::None)
+	{
+		return false;
+	}
+
+	const ASereneGameMode* GameMode = Cast<ASereneGameMode>(World->GetAuthGameMode());
+	if (GameMode && GameMode->IsGameOver())
+	{
+		return false;
+	}
+
+	const APawn* PlayerPawn = UGameplayStatics::GetPlayerPawn(World, 0);
+	if (!PlayerPawn)
+	{
+		return false;
+	}
+
+	// Hiding: the player is parked inside the spot, not somewhere they can resume from.
+	const UHidingComponent* Hiding = PlayerPawn->FindComponentByClass<UHidingComponent>();
+	if (Hiding && Hiding->GetHidingState() != EHidingState::Free)
+	{
+		return false;
+	}
+
+	// A checkpoint mid-chase would drop the player straight back into it.
+	for (TActorIterator<AWendigoCharacter> It(World); It; ++It)
+	{
+		if (!It->IsDormant() && (It->BehaviorState == EWendigoBehaviorState::Chasing
+			|| It->BehaviorState == EWendigoBehaviorState::GrabAttack))
 		{
-			LatestTimestamp = SaveGame->SlotInfo.Timestamp;
-			LatestSlot = i;
+			return false;
 		}
 	}
 
-	return LatestSlot;
+	return true;
+}
+
+FSaveSnapshot* USaveSubsystem::AddCheckpoint(FName Reason, float WorldTime)
+{
+	if (Checkpoints.Num() == 0)
+	{
+		return nullptr;
+	}
+
+	FCheckpoint& Checkpoint = Checkpoints[CheckpointHead];
+	Checkpoint.Reason = Reason;
+	Checkpoint.WorldTime = WorldTime;
+
+	CheckpointHead = (CheckpointHead + 1) % Checkpoints.Num();
+	NumCheckpoints = FMath::Min(NumCheckpoints + 1, Checkpoints.Num());
+
+	return &Checkpoint.Snapshot;
+}
+
+const USaveSubsystem::FCheckpoint* USaveSubsystem::GetLatestCheckpoint() const
+{
+	if (NumCheckpoints == 0 || Checkpoints.Num() == 0)
+	{
+		return nullptr;
+	}
+
+	return &Checkpoints[(CheckpointHead + Checkpoints.Num() - 1) % Checkpoints.Num()];
 }
 
 // ---------------------------------------------------------------------------
 // State Management
 // ---------------------------------------------------------------------------
 
-void USaveSubsystem::ApplyPendingSaveData(UWorld* World)
+void USaveSubsystem::ApplyPendingSaveDataWhenReady(UWorld* World)
 {
-	if (!PendingSaveData || !World)
+	if (PendingLoadState == EPendingLoadState::Loading)
 	{
+		UE_LOG(LogSerene, Log, TEXT("ApplyPendingSaveDataWhenReady: actors ready before save data, deferring"));
+		PendingApplyWorld = World;
 		return;
 	}
 
-	UE_LOG(LogSerene, Log, TEXT("ApplyPendingSaveData: restoring saved state"));
+	ApplyPendingSaveData(World);
+}
 
-	// 1. Restore door states via ISaveable
-	for (TActorIterator<ADoorActor> It(World); It; ++It)
+void USaveSubsystem::ApplyPendingSaveData(UWorld* World)
+{
+	if (!PendingSaveData || !World)
 	{
-		ADoorActor* Door = *It;
-		if (Door)
-		{
-			ISaveable::Execute_ReadSaveData(Door, PendingSaveData);
-		}
+		return;
 	}
 
-	// 2. Restore drawer states via ISaveable
-	for (TActorIterator<ADrawerActor> It(World); It; ++It)
+	UE_LOG(LogSerene, Log, TEXT("ApplyPendingSaveData: restoring saved state%s"), bPendingLoadInPlace ? TEXT(" in place") : TEXT(""));
+
+	ApplySaveData(World, PendingSaveData, bPendingLoadInPlace);
+
+	// Dying after a load retries from the loaded state without reading the save again
+	NumCheckpoints = 0;
+	if (FSaveSnapshot* Checkpoint = AddCheckpoint(TEXT("Load"), World->GetTimeSeconds()))
 	{
-		ADrawerActor* Drawer = *It;
-		if (Drawer)
+		Checkpoint->CopyFrom(*PendingSaveData);
+		Checkpoint->SlotInfo.ScreenshotData.Empty();
+
+		// Version 1 saves carry no map name; the checkpoint belongs to the level just restored
+		if (Checkpoint->SlotInfo.MapName.IsEmpty())
 		{
-			ISaveable::Execute_ReadSaveData(Drawer, PendingSaveData);
+			Checkpoint->SlotInfo.MapName = UGameplayStatics::GetCurrentLevelName(World);
 		}
 	}
 
-	// 3. Destroy picked-up items
-	TArray<APickupActor*> ToDestroy;
-	for (TActorIterator<APickupActor> It(World); It; ++It)
+	// Clear pending data -- load is complete
+	PendingSaveData = nullptr;
+	PendingLoadState = EPendingLoadState::None;
+	bPendingLoadInPlace = false;
+}
+
+void USaveSubsystem::ApplySaveData(UWorld* World, USereneSaveGame* SaveGame, bool bResetFirst)
+{
+	// Triggers the player is moved into fire during the restore; no checkpoint of a half-restored world.
+	TGuardValue<bool> ApplyingGuard(bApplyingSaveData, true);
+
+	// 0. In place: the level was not reloaded, so put it back to its start state first
+	if (bResetFirst)
 	{
-		APickupActor* Pickup = *It;
-		if (Pickup && PendingSaveData->DestroyedPickupIds.Contains(Pickup->GetFName()))
+		if (ULevelResetSubsystem* LevelReset = World->GetSubsystem<ULevelResetSubsystem>())
 		{
-			ToDestroy.Add(Pickup);
+			LevelReset->ResetToLevelStart();
 		}
 	}
-	for (APickupActor* Pickup : ToDestroy)
+
+	// 1. Restore saveables (doors, drawers, picked-up pickups) -- each looks up its own record by save id
+	if (USaveableRegistrySubsystem* Registry = World->GetSubsystem<USaveableRegistrySubsystem>())
 	{
-		UE_LOG(LogSerene, Verbose, TEXT("  Destroying pickup: %s"), *Pickup->GetFName().ToString());
-		Pickup->Destroy();
+		Registry->ReadAll(SaveGame);
 	}
 
-	// 4. Set player position
+	// 2. Set player position
 	APawn* PlayerPawn = UGameplayStatics::GetPlayerPawn(World, 0);
 	if (PlayerPawn)
 	{
-		PlayerPawn->SetActorLocation(PendingSaveData->PlayerLocation);
+		PlayerPawn->SetActorLocation(SaveGame->PlayerLocation);
 
 		AController* Controller = PlayerPawn->GetController();
 		if (Controller)
 		{
-			Controller->SetControlRotation(PendingSaveData->PlayerRotation);
+			Controller->SetControlRotation(SaveGame->PlayerRotation);
 		}
 
 		UE_LOG(LogSerene, Log, TEXT("  Player position restored to %s"),
-			*PendingSaveData->PlayerLocation.ToString());
+			*SaveGame->PlayerLocation.ToString());
 	}
 
-	// 5. Restore inventory
+	// 3. Restore inventory
 	ASereneCharacter* Character = Cast<ASereneCharacter>(PlayerPawn);
 	if (Character)
 	{
 		UInventoryComponent* Inventory = Character->FindComponentByClass<UInventoryComponent>();
 		if (Inventory)
 		{
-			Inventory->RestoreSavedInventory(PendingSaveData->InventorySlots);
+			Inventory->RestoreSavedInventory(SaveGame->InventorySlots);
 			UE_LOG(LogSerene, Log, TEXT("  Inventory restored (%d slots)"),
-				PendingSaveData->InventorySlots.Num());
+				SaveGame->InventorySlots.Num());
 		}
 	}
 
-	// 6. Repopulate destroyed pickup tracker
+	// 4. Repopulate destroyed pickup tracker
 	DestroyedPickupTracker.Empty();
-	for (const FName& Id : PendingSaveData->DestroyedPickupIds)
+	for (const FName& Id : SaveGame->DestroyedPickupIds)
 	{
 		DestroyedPickupTracker.Add(Id);
 	}
 
-	UE_LOG(LogSerene, Log, TEXT("ApplyPendingSaveData: complete (doors=%d, drawers=%d, destroyed=%d)"),
-		PendingSaveData->DoorStates.Num(),
-		PendingSaveData->DrawerStates.Num(),
-		PendingSaveData->DestroyedPickupIds.Num());
-
-	// Clear pending data -- load is complete
-	PendingSaveData = nullptr;
+	UE_LOG(LogSerene, Log, TEXT("ApplySaveData: complete (doors=%d, drawers=%d, destroyed=%d)"),
+		SaveGame->DoorStates.Num(),
+		SaveGame->DrawerStates.Num(),
+		SaveGame->DestroyedPickupIds.Num());
 }
 
 void USaveSubsystem::TrackDestroyedPickup(FName PickupId)
@@ -356,41 +709,72 @@ FString USaveSubsystem::GetSlotName(int32 SlotIndex) const
 	return FString::Printf(TEXT("SaveSlot_%d"), SlotIndex);
 }
 
-void USaveSubsystem::GatherWorldState(USereneSaveGame* SaveGame, UWorld* World)
+void USaveSubsystem::RebuildSaveIndex()
 {
-	SaveGame->DoorStates.Empty();
-	SaveGame->DrawerStates.Empty();
-
-	// Gather door states via ISaveable
-	for (TActorIterator<ADoorActor> It(World); It; ++It)
+	for (int32 i = 0; i < MaxSlots; ++i)
 	{
-		ADoorActor* Door = *It;
-		if (!Door || Door->IsActorBeingDestroyed())
+		// Slot info only: thumbnail and game state sections are never read.
+		const USereneSaveGame* SaveGame = FSaveFileFormat::ReadFromSlot(GetSlotName(i), ESaveReadParts::None);
+
+		if (SaveGame)
 		{
-			continue;
+			SaveIndex.SetEntry(i, SaveGame->SlotInfo);
 		}
+		else
+		{
+			SaveIndex.ClearEntry(i);
+		}
+	}
 
-		ISaveable::Execute_WriteSaveData(Door, SaveGame);
+	// Written even when empty so later launches skip the scan.
+	SaveIndex.Write();
+
+	UE_LOG(LogSerene, Log, TEXT("RebuildSaveIndex: indexed existing saves"));
+}
+
+void USaveSubsystem::CaptureSnapshot(FSaveSnapshot& Snapshot, UWorld* World, bool bUseSaveLocation)
+{
+	GatherWorldState(Snapshot, World);
+	GatherPlayerState(Snapshot, World, bUseSaveLocation);
+
+	Snapshot.DestroyedPickupIds.Reset(DestroyedPickupTracker.Num());
+	for (const FName& Id : DestroyedPickupTracker)
+	{
+		Snapshot.DestroyedPickupIds.Add(Id);
 	}
 
-	// Gather drawer states via ISaveable
-	for (TActorIterator<ADrawerActor> It(World); It; ++It)
+	// Summary shown in the save/load menu (mirrored into the slot index)
+	Snapshot.SlotInfo.Timestamp = FDateTime::Now();
+	Snapshot.SlotInfo.MapName = UGameplayStatics::GetCurrentLevelName(World);
+	Snapshot.SlotInfo.InventoryItemCount = 0;
+	for (const FInventorySlot& InventorySlot : Snapshot.InventorySlots)
 	{
-		ADrawerActor* Drawer = *It;
-		if (!Drawer || Drawer->IsActorBeingDestroyed())
-		{
-			continue;
-		}
+		Snapshot.SlotInfo.InventoryItemCount += InventorySlot.IsEmpty() ? 0 : 1;
+	}
+	Snapshot.SlotInfo.ScreenshotData.Reset();
+	Snapshot.SlotInfo.ScreenshotWidth = 0;
+	Snapshot.SlotInfo.ScreenshotHeight = 0;
+}
+
+void USaveSubsystem::GatherWorldState(FSaveSnapshot& Snapshot, UWorld* World)
+{
+	Snapshot.DoorStates.Reset();
+	Snapshot.DrawerStates.Reset();
 
-		ISaveable::Execute_WriteSaveData(Drawer, SaveGame);
+	// Saveables changed since the last save are re-written; the rest come from the registry's snapshot
+	if (USaveableRegistrySubsystem* Registry = World->GetSubsystem<USaveableRegistrySubsystem>())
+	{
+		Registry->WriteAll(Snapshot);
 	}
 
 	UE_LOG(LogSerene, Verbose, TEXT("GatherWorldState: %d doors, %d drawers"),
-		SaveGame->DoorStates.Num(), SaveGame->DrawerStates.Num());
+		Snapshot.DoorStates.Num(), Snapshot.DrawerStates.Num());
 }
 
-void USaveSubsystem::GatherPlayerState(USereneSaveGame* SaveGame, UWorld* World)
+void USaveSubsystem::GatherPlayerState(FSaveSnapshot& Snapshot, UWorld* World, bool bUseSaveLocation)
 {
+	Snapshot.InventorySlots.Reset();
+
 	APawn* PlayerPawn = UGameplayStatics::GetPlayerPawn(World, 0);
 	if (!PlayerPawn)
 	{
@@ -399,21 +783,18 @@ void USaveSubsystem::GatherPlayerState(USereneSaveGame* SaveGame, UWorld* World)
 	}
 
 	// Use pending save location (tape recorder) if set, otherwise use player's actual position
-	if (bHasPendingSaveLocation)
+	if (bUseSaveLocation && bHasPendingSaveLocation)
 	{
-		SaveGame->PlayerLocation = PendingSaveLocation;
-		SaveGame->PlayerRotation = PendingSaveRotation;
+		Snapshot.PlayerLocation = PendingSaveLocation;
+		Snapshot.PlayerRotation = PendingSaveRotation;
 		UE_LOG(LogSerene, Log, TEXT("GatherPlayerState: using pending save location %s"), *PendingSaveLocation.ToString());
 	}
 	else
 	{
-		SaveGame->PlayerLocation = PlayerPawn->GetActorLocation();
+		Snapshot.PlayerLocation = PlayerPawn->GetActorLocation();
 
 		AController* Controller = PlayerPawn->GetController();
-		if (Controller)
-		{
-			SaveGame->PlayerRotation = Controller->GetControlRotation();
-		}
+		Snapshot.PlayerRotation = Controller ? Controller->GetControlRotation() : PlayerPawn->GetActorRotation();
 	}
 
 	// Gather inventory
@@ -423,74 +804,118 @@ void USaveSubsystem::GatherPlayerState(USereneSaveGame* SaveGame, UWorld* World)
 		UInventoryComponent* Inventory = Character->FindComponentByClass<UInventoryComponent>();
 		if (Inventory)
 		{
-			SaveGame->InventorySlots = Inventory->GetSlots();
+			Snapshot.InventorySlots = Inventory->GetSlots();
 		}
 	}
 
 	UE_LOG(LogSerene, Verbose, TEXT("GatherPlayerState: location=%s, inventory=%d slots"),
-		*SaveGame->PlayerLocation.ToString(), SaveGame->InventorySlots.Num());
+		*Snapshot.PlayerLocation.ToString(), Snapshot.InventorySlots.Num());
 }
 
 // ---------------------------------------------------------------------------
 // Screenshot Capture
 // ---------------------------------------------------------------------------
 
-void USaveSubsystem::OnScreenshotCaptured(int32 Width, int32 Height, const TArray<FColor>& Bitmap)
+void USaveSubsystem::EncodeThumbnail(int32 Width, int32 Height, const TArray<FColor>& Bitmap, FSaveSlotInfo& OutInfo)
 {
-	// Unbind delegate (one-shot pattern)
-	UGameViewportClient::OnScreenshotCaptured().Remove(ScreenshotDelegateHandle);
-	ScreenshotDelegateHandle.Reset();
-
-	if (!PendingSaveObject)
+	if (Width <= 0 || Height <= 0 || Bitmap.Num() != Width * Height)
 	{
-		UE_LOG(LogSerene, Warning, TEXT("OnScreenshotCaptured: no pending save object"));
+		UE_LOG(LogSerene, Warning, TEXT("EncodeThumbnail: invalid screenshot (%dx%d, %d pixels)"), Width, Height, Bitmap.Num());
 		return;
 	}
 
-	// Compress screenshot to JPEG via FImageUtils::CompressImage
-	FImageView ImageView(Bitmap.GetData(), Width, Height);
+	// Downscale to what the slot menu shows; never upscale.
+	TArray<FColor> Scaled;
+	const FColor* Pixels = Bitmap.GetData();
+	int32 ThumbWidth = Width;
+	int32 ThumbHeight = Height;
+	if (Width > ThumbnailWidth)
+	{
+		ThumbWidth = ThumbnailWidth;
+		ThumbHeight = FMath::Max(1, FMath::RoundToInt32(static_cast<float>(Height) * ThumbnailWidth / Width));
+		FImageUtils::ImageResize(Width, Height, Bitmap, ThumbWidth, ThumbHeight, Scaled, false, true);
+		Pixels = Scaled.GetData();
+	}
+
+	FImageView ImageView(Pixels, ThumbWidth, ThumbHeight);
 	TArray64<uint8> CompressedData;
 	const bool bCompressed = FImageUtils::CompressImage(CompressedData, TEXT("jpg"), ImageView, 85);
 
 	if (bCompressed && CompressedData.Num() > 0)
 	{
 		// Copy from TArray64 to TArray for UPROPERTY serialization
-		PendingSaveObject->SlotInfo.ScreenshotData.SetNumUninitialized(CompressedData.Num());
-		FMemory::Memcpy(
-			PendingSaveObject->SlotInfo.ScreenshotData.GetData(),
-			CompressedData.GetData(),
-			CompressedData.Num());
-		PendingSaveObject->SlotInfo.ScreenshotWidth = Width;
-		PendingSaveObject->SlotInfo.ScreenshotHeight = Height;
+		OutInfo.ScreenshotData.SetNumUninitialized(CompressedData.Num());
+		FMemory::Memcpy(OutInfo.ScreenshotData.GetData(), CompressedData.GetData(), CompressedData.Num());
+		OutInfo.ScreenshotWidth = ThumbWidth;
+		OutInfo.ScreenshotHeight = ThumbHeight;
 
-		UE_LOG(LogSerene, Log, TEXT("Screenshot compressed: %dx%d -> %lld bytes JPEG"),
-			Width, Height, CompressedData.Num());
+		UE_LOG(LogSerene, Log, TEXT("Screenshot compressed: %dx%d -> %dx%d, %lld bytes JPEG"),
+			Width, Height, ThumbWidth, ThumbHeight, CompressedData.Num());
 	}
 	else
 	{
-		UE_LOG(LogSerene, Warning, TEXT("Screenshot compression failed (%dx%d, %d pixels)"),
-			Width, Height, Bitmap.Num());
+		UE_LOG(LogSerene, Warning, TEXT("Screenshot compression failed (%dx%d)"), ThumbWidth, ThumbHeight);
 	}
+}
 
-	// Write save to disk asynchronously
-	const FString SlotName = GetSlotName(PendingSaveSlotIndex);
+void USaveSubsystem::OnScreenshotCaptured(int32 Width, int32 Height, const TArray<FColor>& Bitmap)
+{
+	// Unbind delegate (one-shot pattern)
+	UGameViewportClient::OnScreenshotCaptured().Remove(ScreenshotDelegateHandle);
+	ScreenshotDelegateHandle.Reset();
 
-	FAsyncSaveGameToSlotDelegate OnSaveComplete;
-	OnSaveComplete.BindLambda([SlotName](const FString& SavedSlotName, const int32 UserIndex, bool bSuccess)
+	if (PendingSaveSlotIndex < 0)
 	{
-		if (bSuccess)
-		{
-			UE_LOG(LogSerene, Log, TEXT("Save complete: %s"), *SavedSlotName);
-		}
-		else
+		UE_LOG(LogSerene, Warning, TEXT("OnScreenshotCaptured: no pending save"));
+		return;
+	}
+
+	// The game thread only hands the snapshot and bitmap over. Downscale, JPEG encode, save
+	// encode and the file write run back to back on a worker; no UObject is involved.
+	AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask,
+		[WeakThis = TWeakObjectPtr<USaveSubsystem>(this), Snapshot = MoveTemp(PendingSaveSnapshot),
+		SlotName = GetSlotName(PendingSaveSlotIndex), SlotIndex = PendingSaveSlotIndex,
+		Width, Height, Bitmap = TArray<FColor>(Bitmap)]() mutable
+	{
+		EncodeThumbnail(Width, Height, Bitmap, Snapshot.SlotInfo);
+
+		TArray<uint8> SaveData;
+		const bool bSuccess = FSaveFileFormat::Write(Snapshot, SaveData)
+			&& FSaveFileFormat::WriteToSlot(SaveData, SlotName);
+
+		// The thumbnail lives in the save file only; the index keeps its size.
+		Snapshot.SlotInfo.ScreenshotData.Empty();
+
+		AsyncTask(ENamedThreads::GameThread, [WeakThis, SlotInfo = MoveTemp(Snapshot.SlotInfo), SlotName, SlotIndex, bSuccess,
+			NumBytes = SaveData.Num(), NumDoors = Snapshot.DoorStates.Num(), NumDrawers = Snapshot.DrawerStates.Num()]()
 		{
-			UE_LOG(LogSerene, Error, TEXT("Save FAILED: %s"), *SavedSlotName);
-		}
+			USaveSubsystem* Self = WeakThis.Get();
+			if (Self)
+			{
+				Self->InFlightSaveSlotIndex = -1;
+			}
+
+			if (bSuccess)
+			{
+				UE_LOG(LogSerene, Log, TEXT("Save complete: %s, %d bytes (%d doors, %d drawers changed)"), *SlotName,
+					NumBytes, NumDoors, NumDrawers);
+
+				// Index only after the save is on disk, so it never points at a missing save.
+				if (Self)
+				{
+					Self->SaveIndex.SetEntry(SlotIndex, SlotInfo);
+					Self->SaveIndex.Write();
+					Self->InvalidateThumbnail(SlotIndex);
+				}
+			}
+			else
+			{
+				UE_LOG(LogSerene, Error, TEXT("Save FAILED: %s"), *SlotName);
+			}
+		});
 	});
 
-	UGameplayStatics::AsyncSaveGameToSlot(PendingSaveObject, SlotName, 0, OnSaveComplete);
-
 	// Clear pending save state
-	PendingSaveObject = nullptr;
+	PendingSaveSnapshot = FSaveSnapshot();
 	PendingSaveSlotIndex = -1;
 }
@@ -0,0 +1,221 @@
+// Copyright Null Lantern.
+
+#include "Save/SaveableRegistrySubsystem.h"
+#include "Interaction/SaveableInterface.h"
+#include "Save/SereneSaveGame.h"
+#include "Save/SaveSnapshot.h"
+#include "HAL/IConsoleManager.h"
+#include "Core/SereneLogChannels.h"
+
+static TAutoConsoleVariable<int32> CVarSaveFullGather(
+	TEXT("Serene.Save.FullGather"),
+	0,
+	TEXT("1 = every save re-writes every saveable instead of only those journalled since the last save."),
+	ECVF_Default);
+
+void USaveableRegistrySubsystem::Deinitialize()
+{
+	SaveIdToActor.Empty();
+	ActorToSaveId.Empty();
+	DirtySaveIds.Empty();
+	DoorSnapshot.Empty();
+	DrawerSnapshot.Empty();
+	FoldScratch = nullptr;
+
+	Super::Deinitialize();
+}
+
+bool USaveableRegistrySubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+// ---------------------------------------------------------------------------
+// Registration
+// ---------------------------------------------------------------------------
+
+void USaveableRegistrySubsystem::RegisterSaveable(AActor* Saveable)
+{
+	if (!Saveable || !Saveable->Implements<USaveable>() || ActorToSaveId.Contains(Saveable))
+	{
+		return;
+	}
+
+	const FName SaveId = ISaveable::Execute_GetSaveId(Saveable);
+	if (SaveId.IsNone())
+	{
+		return;
+	}
+
+	if (const TWeakObjectPtr<AActor>* Existing = SaveIdToActor.Find(SaveId); Existing && Existing->IsValid())
+	{
+		UE_LOG(LogSerene, Warning, TEXT("SaveableRegistry: %s has save id %s already used by %s -- not saved"),
+			*Saveable->GetName(), *SaveId.ToString(), *(*Existing)->GetName());
+		return;
+	}
+
+	SaveIdToActor.Add(SaveId, Saveable);
+	ActorToSaveId.Add(Saveable, SaveId);
+}
+
+void USaveableRegistrySubsystem::UnregisterSaveable(AActor* Saveable)
+{
+	FName SaveId;
+	if (!Saveable || !ActorToSaveId.RemoveAndCopyValue(Saveable, SaveId))
+	{
+		return;
+	}
+
+	SaveIdToActor.Remove(SaveId);
+}
+
+AActor* USaveableRegistrySubsystem::FindSaveable(FName SaveId) const
+{
+	const TWeakObjectPtr<AActor>* Found = SaveIdToActor.Find(SaveId);
+	return Found ? Found->Get() : nullptr;
+}
+
+// ---------------------------------------------------------------------------
+// Save / Load
+// ---------------------------------------------------------------------------
+
+void USaveableRegistrySubsystem::MarkDirty(AActor* Saveable)
+{
+	if (const FName* SaveId = ActorToSaveId.Find(Saveable))
+	{
+		DirtySaveIds.Add(*SaveId);
+	}
+}
+
+void USaveableRegistrySubsystem::MarkAllDirty()
+{
+	DirtySaveIds.Reserve(SaveIdToActor.Num());
+	for (const TPair<FName, TWeakObjectPtr<AActor>>& Pair : SaveIdToActor)
+	{
+		DirtySaveIds.Add(Pair.Key);
+	}
+}
+
+void USaveableRegistrySubsystem::WriteAll(FSaveSnapshot& OutSnapshot)
+{
+	if (CVarSaveFullGather.GetValueOnGameThread() != 0)
+	{
+		MarkAllDirty();
+	}
+
+	FoldJournal();
+
+	OutSnapshot.DoorStates.Reserve(OutSnapshot.DoorStates.Num() + DoorSnapshot.Num());
+	for (const TPair<FName, FSavedDoorState>& Pair : DoorSnapshot)
+	{
+		OutSnapshot.DoorStates.Add(Pair.Value);
+	}
+
+	OutSnapshot.DrawerStates.Reserve(OutSnapshot.DrawerStates.Num() + DrawerSnapshot.Num());
+	for (const TPair<FName, FSavedDrawerState>& Pair : DrawerSnapshot)
+	{
+		OutSnapshot.DrawerStates.Add(Pair.Value);
+	}
+}
+
+void USaveableRegistrySubsystem::ReadAll(USereneSaveGame* SaveGame)
+{
+	for (AActor* Saveable : GetSaveablesSnapshot())
+	{
+		if (IsValid(Saveable) && !Saveable->IsActorBeingDestroyed())
+		{
+			ISaveable::Execute_ReadSaveData(Saveable, SaveGame);
+		}
+	}
+
+	// The world now matches SaveGame: seed the snapshot with its records for saveables that exist.
+	DirtySaveIds.Reset();
+	DoorSnapshot.Reset();
+	DrawerSnapshot.Reset();
+	for (const FSavedDoorState& State : SaveGame->DoorStates)
+	{
+		if (SaveIdToActor.Contains(State.DoorId))
+		{
+			DoorSnapshot.Add(State.DoorId, State);
+		}
+	}
+	for (const FSavedDrawerState& State : SaveGame->DrawerStates)
+	{
+		if (SaveIdToActor.Contains(State.DrawerId))
+		{
+			DrawerSnapshot.Add(State.DrawerId, State);
+		}
+	}
+}
+
+void USaveableRegistrySubsystem::ResetAll()
+{
+	for (AActor* Saveable : GetSaveablesSnapshot())
+	{
+		if (IsValid(Saveable) && !Saveable->IsActorBeingDestroyed())
+		{
+			ISaveable::Execute_ResetToLevelDefault(Saveable);
+		}
+	}
+
+	// Everything is at its level default again.
+	DirtySaveIds.Reset();
+	DoorSnapshot.Reset();
+	DrawerSnapshot.Reset();
+}
+
+void USaveableRegistrySubsystem::FoldJournal()
+{
+	if (DirtySaveIds.Num() == 0)
+	{
+		return;
+	}
+
+	if (!FoldScratch)
+	{
+		FoldScratch = NewObject<USereneSaveGame>(this);
+	}
+	FoldScratch->DoorStates.Reset();
+	FoldScratch->DrawerStates.Reset();
+
+	// A saveable back at its default writes nothing, so dropping its old record first removes it.
+	for (const FName& SaveId : DirtySaveIds)
+	{
+		DoorSnapshot.Remove(SaveId);
+		DrawerSnapshot.Remove(SaveId);
+
+		AActor* Saveable = FindSaveable(SaveId);
+		if (Saveable && !Saveable->IsActorBeingDestroyed())
+		{
+			ISaveable::Execute_WriteSaveData(Saveable, FoldScratch);
+		}
+	}
+
+	for (const FSavedDoorState& State : FoldScratch->DoorStates)
+	{
+		DoorSnapshot.Add(State.DoorId, State);
+	}
+	for (const FSavedDrawerState& State : FoldScratch->DrawerStates)
+	{
+		DrawerSnapshot.Add(State.DrawerId, State);
+	}
+
+	UE_LOG(LogSerene, Verbose, TEXT("SaveableRegistry: folded %d journalled saveables (%d doors, %d drawers changed in total)"),
+		DirtySaveIds.Num(), DoorSnapshot.Num(), DrawerSnapshot.Num());
+
+	DirtySaveIds.Reset();
+}
+
+TArray<AActor*> USaveableRegistrySubsystem::GetSaveablesSnapshot() const
+{
+	TArray<AActor*> Saveables;
+	Saveables.Reserve(SaveIdToActor.Num());
+	for (const TPair<FName, TWeakObjectPtr<AActor>>& Pair : SaveIdToActor)
+	{
+		if (AActor* Saveable = Pair.Value.Get())
+		{
+			Saveables.Add(Saveable);
+		}
+	}
+	return Saveables;
+}
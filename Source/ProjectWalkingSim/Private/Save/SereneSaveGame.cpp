@@ -7,3 +7,50 @@ USereneSaveGame::USereneSaveGame()
 	, PlayerRotation(FRotator::ZeroRotator)
 {
 }
+
+// ---------------------------------------------------------------------------
+// Restore Lookups
+// ---------------------------------------------------------------------------
+
+void USereneSaveGame::BuildLookups() const
+{
+	if (bLookupsBuilt)
+	{
+		return;
+	}
+
+	DoorIndexById.Reserve(DoorStates.Num());
+	for (int32 i = 0; i < DoorStates.Num(); ++i)
+	{
+		DoorIndexById.Add(DoorStates[i].DoorId, i);
+	}
+
+	DrawerIndexById.Reserve(DrawerStates.Num());
+	for (int32 i = 0; i < DrawerStates.Num(); ++i)
+	{
+		DrawerIndexById.Add(DrawerStates[i].DrawerId, i);
+	}
+
+	DestroyedPickupSet.Append(DestroyedPickupIds);
+	bLookupsBuilt = true;
+}
+
+const FSavedDoorState* USereneSaveGame::FindDoorState(FName DoorId) const
+{
+	BuildLookups();
+	const int32* Index = DoorIndexById.Find(DoorId);
+	return Index ? &DoorStates[*Index] : nullptr;
+}
+
+const FSavedDrawerState* USereneSaveGame::FindDrawerState(FName DrawerId) const
+{
+	BuildLookups();
+	const int32* Index = DrawerIndexById.Find(DrawerId);
+	return Index ? &DrawerStates[*Index] : nullptr;
+}
+
+bool USereneSaveGame::IsPickupDestroyed(FName PickupId) const
+{
+	BuildLookups();
+	return DestroyedPickupSet.Contains(PickupId);
+}
@@ -24,7 +24,10 @@ public class ProjectWalkingSim : ModuleRules
 			"AIModule",
 			"NavigationSystem",
 			"StateTreeModule",
-			"GameplayStateTreeModule"
+			"GameplayStateTreeModule",
+
+			// Wendigo animation budgeting
+			"AnimationBudgetAllocator"
 		});
 
 		PrivateDependencyModuleNames.AddRange(new string[] {
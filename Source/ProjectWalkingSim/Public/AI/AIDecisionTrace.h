@@ -0,0 +1,192 @@
+// Copyright Null Lantern.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AIDecisionTrace.generated.h"
+
+class AWendigoCharacter;
+class AAIController;
+class USuspicionComponent;
+
+/** Compiles the decision trace out of Shipping. */
+#ifndef SERENE_AI_TRACE
+#define SERENE_AI_TRACE !UE_BUILD_SHIPPING
+#endif
+
+/**
+ * One Wendigo controller tick: perception inputs, suspicion result, decision state
+ * and movement request. Plain data, written verbatim to trace files.
+ */
+struct FAIDecisionTraceRecord
+{
+	enum EFlags : uint8
+	{
+		SeeingPlayer = 1 << 0
+	};
+
+	double WorldTime = 0.0;
+	uint32 FrameNumber = 0;
+	float DeltaTime = 0.0f;
+
+	/** Real game-thread time of the previous frame -- what a hitch looks like. */
+	float FrameMs = 0.0f;
+
+	/** Visibility score fed to ProcessSightStimulus (valid with SeeingPlayer). */
+	float VisibilityScore = 0.0f;
+
+	/** Suspicion after this tick. */
+	float Suspicion = 0.0f;
+
+	FVector3f PawnLocation = FVector3f::ZeroVector;
+	FVector3f PlayerLocation = FVector3f::ZeroVector;
+	FVector3f PlayerVelocity = FVector3f::ZeroVector;
+
+	/** Last hearing stimulus received since the previous tick (valid when NumHeardNoises > 0). */
+	FVector3f NoiseLocation = FVector3f::ZeroVector;
+
+	/** Path following target location. */
+	FVector3f MoveGoal = FVector3f::ZeroVector;
+
+	/** Index into the trace's Wendigo name table. */
+	uint16 WendigoId = 0;
+
+	/** Index into the trace's task name table (last StateTree task entered). */
+	uint8 ActiveTask = 0;
+
+	uint8 AlertLevel = 0;
+	uint8 BehaviorState = 0;
+
+	/** EPathFollowingStatus::Type. */
+	uint8 MoveStatus = 0;
+
+	uint8 Flags = 0;
+
+	/** Hearing stimuli received since the previous tick (saturates at 255). */
+	uint8 NumHeardNoises = 0;
+};
+
+/**
+ * A traced Wendigo's USuspicionComponent tuning (its EditAnywhere values), written
+ * once per controller so replay runs with the instance's values, not C++ defaults.
+ */
+struct FAIDecisionTraceTuning
+{
+	float VisibilityThreshold = 0.0f;
+	float BaseSuspicionRate = 0.0f;
+	float SuspicionDecayRate = 0.0f;
+	float SuspiciousThreshold = 0.0f;
+	float AlertThreshold = 0.0f;
+	float HearingSuspicionBump = 0.0f;
+
+	void CaptureFrom(const USuspicionComponent& Suspicion);
+	void ApplyTo(USuspicionComponent& Suspicion) const;
+
+	friend FArchive& operator<<(FArchive& Ar, FAIDecisionTraceTuning& Tuning);
+};
+
+/**
+ * Fixed-memory binary recorder for Wendigo decisions (development builds only).
+ *
+ * Every AWendigoAIController tick appends one FAIDecisionTraceRecord to a ring
+ * buffer of Serene.AI.Trace.Capacity records, allocated once. Nothing is
+ * formatted or logged while recording. The buffer is written to
+ * Saved/AITrace/*.sait:
+ *   - on demand:   Serene.AI.TraceDump
+ *   - on a hitch:  a frame longer than Serene.AI.Trace.HitchMs, after
+ *                  Serene.AI.Trace.PostHitchFrames more frames of context
+ *
+ * Serene.AI.TraceReplay <File> [FirstFrame] [LastFrame] replays a trace offline
+ * without a world: recorded perception inputs go through a fresh
+ * USuspicionComponent carrying the traced instance's tuning, i.e. the same code
+ * and values the controller runs. Each Wendigo is seeded from its first record
+ * (the ring may start mid-game); after that replayed state is never corrected
+ * from the recording, so a divergence from the recorded suspicion/alert level
+ * is reported and carries forward. The replay covers perception and suspicion
+ * only -- StateTree tasks and movement need a world, so task and move fields
+ * are reported as recorded. The replay is timed (and shows in Unreal Insights),
+ * and a CSV of every record is written next to the trace for inspection in a
+ * spreadsheet.
+ * Headless: UnrealEditor-Cmd ProjectWalkingSim.uproject -ExecCmds="Serene.AI.TraceReplay <File>, Quit"
+ */
+UCLASS()
+class PROJECTWALKINGSIM_API UAIDecisionTraceSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	/** Append one controller tick. VisibilityScore < 0 means the player was not in sight. */
+	void RecordTick(const AAIController& Controller, const AWendigoCharacter& Wendigo,
+		const AActor* Player, float VisibilityScore, float DeltaTime);
+
+	/** Count a hearing stimulus into the controller's next record. */
+	void NoteHeardNoise(const AAIController& Controller, const FVector& Location);
+
+	/** Remember the StateTree task the owner (controller) just entered. */
+	void NoteTaskEntered(const UObject* Owner, const TCHAR* TaskName);
+
+	/** Write the ring buffer (oldest first). @return Path written, or empty on failure. */
+	FString Dump(const TCHAR* Reason);
+
+	/** Replay a trace file. See class comment. */
+	static void Replay(const FString& Path, uint32 FirstFrame, uint32 LastFrame);
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	/** Per-controller bookkeeping between ticks. */
+	struct FTracedController
+	{
+		uint16 WendigoId = 0;
+		uint8 ActiveTask = 0;
+		uint8 NumHeardNoises = 0;
+		FVector3f NoiseLocation = FVector3f::ZeroVector;
+	};
+
+	FTracedController& FindOrAddController(const UObject* Controller);
+
+	/** Fixed storage, sized once in Initialize. */
+	TArray<FAIDecisionTraceRecord> Records;
+
+	/** Next write position in Records. */
+	int32 Head = 0;
+
+	/** Records written since the last wrap; Records.Num() once full. */
+	int32 NumValid = 0;
+
+	TMap<TObjectKey<UObject>, FTracedController> Controllers;
+	TArray<FString> WendigoNames;
+
+	/** Indexed like WendigoNames. */
+	TArray<FAIDecisionTraceTuning> WendigoTunings;
+
+	/** Index 0 is "None". */
+	TArray<FString> TaskNames;
+
+	double LastTickRealTime = 0.0;
+	float LastFrameMs = 0.0f;
+
+	/** Frames left until a pending hitch dump is written (-1 = none). */
+	int32 HitchDumpCountdown = -1;
+	double LastHitchDumpTime = -1.0e9;
+	float PendingHitchMs = 0.0f;
+};
+
+#if SERENE_AI_TRACE
+/** Record the StateTree task being entered. Place after SERENE_AI_PROFILE_SCOPE in EnterState. */
+#define SERENE_AI_TRACE_TASK_ENTER(NodeName) \
+	if (UAIDecisionTraceSubsystem* SereneAITrace = Context.GetWorld() ? Context.GetWorld()->GetSubsystem<UAIDecisionTraceSubsystem>() : nullptr) \
+	{ \
+		SereneAITrace->NoteTaskEntered(Context.GetOwner(), TEXT(#NodeName)); \
+	}
+#else
+#define SERENE_AI_TRACE_TASK_ENTER(NodeName)
+#endif
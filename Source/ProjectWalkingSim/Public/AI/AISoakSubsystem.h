@@ -0,0 +1,170 @@
+// Copyright Null Lantern.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AI/MonsterAITypes.h"
+#include "AISoakSubsystem.generated.h"
+
+class AWendigoCharacter;
+class APatrolRouteActor;
+class AHidingSpotActor;
+class ASereneCharacter;
+
+/**
+ * Headless AI soak simulator (development builds only).
+ *
+ * Drives the real player pawn with a scripted bot against the real Wendigo
+ * AIController/State Tree for N episodes, then writes CSV statistics to
+ * Saved/Soak/. Intended for unattended runs at a fixed timestep as fast as
+ * the CPU allows:
+ *
+ *   UnrealEditor-Cmd ProjectWalkingSim.uproject /Game/Maps/DemoMap -game -nullrhi -nosound
+ *     -unattended -SereneSoak=1000 [-SereneSoakSeed=1337] [-csvprofile]
+ *
+ * -SereneSoak starts on world BeginPlay and quits when finished; in a normal
+ * session use "Serene.AI.Soak <Episodes>". While running, the engine is
+ * switched to a fixed timestep (Serene.AI.Soak.FixedHz), which skips frame
+ * pacing entirely.
+ *
+ * Bot routes come from recordings ("Serene.AI.Soak.Record <Name>" /
+ * "Serene.AI.Soak.StopRecord" -> Saved/Soak/Routes/<Map>_<Name>.csv) or,
+ * if none exist for the map, from random NavMesh walks. The bot crouches and
+ * sprints as recorded; once chased it sprints and hides in a nearby free
+ * hiding spot with probability Serene.AI.Soak.HideChance.
+ *
+ * Episode ends: route completed (survived), GrabAttack (caught), or timeout.
+ * Output:
+ *   *_Episodes.csv -- per episode: detection, chases, escapes, outcome
+ *   *_Summary.csv  -- rates, simulated vs real time, ms per frame
+ *   *_AINodes.csv  -- per StateTree task/condition CPU totals (Serene.AI.Profile)
+ * Combine with -csvprofile for the engine's per-system frame breakdown.
+ */
+UCLASS()
+class PROJECTWALKINGSIM_API UAISoakSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	/** Run NumEpisodes encounters. @param bQuitWhenDone  Request engine exit after writing results. */
+	void StartSoak(int32 NumEpisodes, bool bQuitWhenDone);
+
+	/** Abort the current soak and write results gathered so far. */
+	void StopSoak();
+
+	/** Start recording the human player's path as a bot route. */
+	void StartRecording(const FString& RouteName);
+
+	/** Stop recording and save the route CSV. */
+	void StopRecording();
+
+	bool IsSoakRunning() const { return bSoakRunning; }
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	struct FBotSample
+	{
+		FVector Location = FVector::ZeroVector;
+		bool bCrouch = false;
+		bool bSprint = false;
+	};
+
+	struct FBotRoute
+	{
+		FString Name;
+		TArray<FBotSample> Samples;
+	};
+
+	struct FTrackedWendigo
+	{
+		TWeakObjectPtr<AWendigoCharacter> Wendigo;
+
+		/** Spawn transform and route at soak start, restored every episode. */
+		FTransform InitialTransform;
+		TWeakObjectPtr<APatrolRouteActor> InitialPatrolRoute;
+		EWendigoBehaviorState LastState = EWendigoBehaviorState::Patrol;
+	};
+
+	enum class EEpisodeOutcome : uint8
+	{
+		Survived,
+		Caught,
+		Timeout
+	};
+
+	struct FEpisodeStats
+	{
+		int32 Index = 0;
+		FString RouteName;
+		float Duration = 0.0f;
+		bool bDetected = false;
+		float TimeToDetect = -1.0f;
+		int32 Chases = 0;
+		int32 Escapes = 0;
+		int32 Hides = 0;
+		float MaxSuspicion = 0.0f;
+		EEpisodeOutcome Outcome = EEpisodeOutcome::Timeout;
+	};
+
+	static const TCHAR* OutcomeToString(EEpisodeOutcome Outcome);
+
+	// --- Soak ---
+
+	void LoadRoutes();
+	bool BuildRandomRoute(FBotRoute& OutRoute);
+	void StartEpisode();
+	void EndEpisode(EEpisodeOutcome Outcome);
+	void ResetWendigos();
+	void TickBot(float DeltaTime);
+	void TickObservation(float DeltaTime);
+	void WriteResults() const;
+	void FinishSoak();
+
+	/** Nearest unoccupied hiding spot within Radius of the player, or null. */
+	AHidingSpotActor* FindHidingSpotNear(const FVector& Location, float Radius) const;
+
+	bool bSoakRunning = false;
+	bool bQuitOnFinish = false;
+	int32 EpisodesRequested = 0;
+
+	TArray<FBotRoute> Routes;
+	FBotRoute CurrentRoute;
+	int32 RouteSampleIndex = 0;
+
+	TArray<FTrackedWendigo> TrackedWendigos;
+	TArray<TWeakObjectPtr<AHidingSpotActor>> HidingSpots;
+	TWeakObjectPtr<ASereneCharacter> BotPawn;
+	FTransform PlayerStartTransform;
+
+	FRandomStream Random;
+
+	FEpisodeStats CurrentEpisode;
+	TArray<FEpisodeStats> CompletedEpisodes;
+
+	/** Whether the bot may hide this episode (rolled per episode). */
+	bool bBotWillHide = false;
+	float BotHiddenTime = 0.0f;
+
+	double SoakStartRealTime = 0.0;
+	double SoakSimTime = 0.0;
+	int64 SoakFrames = 0;
+
+	/** Engine timestep settings restored when the soak ends. */
+	bool bSavedUseFixedTimeStep = false;
+	double SavedFixedDeltaTime = 0.0;
+
+	// --- Recording ---
+
+	bool bRecording = false;
+	FBotRoute RecordingRoute;
+	float RecordAccumulator = 0.0f;
+};
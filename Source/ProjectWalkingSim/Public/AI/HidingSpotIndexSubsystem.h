@@ -0,0 +1,154 @@
+// Copyright Null Lantern.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "GameplayTagContainer.h"
+#include "HidingSpotIndexSubsystem.generated.h"
+
+class AHidingSpotActor;
+
+/** Parameters for UHidingSpotIndexSubsystem::FindBestSpots. */
+struct FHidingSpotQuery
+{
+	/** Search centre (usually the player's last-known location). */
+	FVector Origin = FVector::ZeroVector;
+
+	/**
+	 * Only spots whose actor location is within this straight-line distance are
+	 * considered. Approach points are resolved after this cut.
+	 */
+	float Radius = 1500.0f;
+
+	/** Maximum number of results. */
+	int32 MaxResults = 2;
+
+	/** Score multiplier per SpotTypeTag (exact match). Missing tags score 1. May be null. */
+	const TMap<FGameplayTag, float>* TypeWeights = nullptr;
+
+	/** Seconds after a check before a spot regains full priority (linear ramp). */
+	float RecheckCooldown = 60.0f;
+
+	/** Spot that always sorts first if it is in range (e.g., the witnessed hiding spot). */
+	const AActor* PrioritySpot = nullptr;
+
+	/** Nav agent whose nav data is used for path distances. */
+	const AActor* Querier = nullptr;
+};
+
+/** One scored result of FindBestSpots. */
+struct FHidingSpotCandidate
+{
+	TWeakObjectPtr<AHidingSpotActor> Spot;
+
+	/** NavMesh point in front of the spot where a searcher should stand. */
+	FVector ApproachPoint = FVector::ZeroVector;
+
+	/** NavMesh path length from the query origin to ApproachPoint. */
+	float PathDistance = 0.0f;
+
+	float Score = 0.0f;
+};
+
+/**
+ * Spatial index of every AHidingSpotActor in the level, for AI search.
+ *
+ * Spots register in BeginPlay and are bucketed into a uniform grid
+ * (CellSize). Each entry stores a NavMesh approach point (resolved lazily on
+ * first query) and a small cache of path lengths keyed by quantised query
+ * origin, so repeated searches around the same area do not re-run pathfinding.
+ *
+ * FindBestSpots visits only the grid cells overlapping the query radius and
+ * scores every spot in range:
+ *   TypeWeight * Recency * DiscoveredBonus / (1 + PathDistance / Radius)
+ * Recency ramps from 0 (just checked) to 1 over RecheckCooldown seconds;
+ * zero-score spots are dropped. The broad phase uses straight-line distance
+ * (an upper bound on the score, as a path is never shorter) and keeps the
+ * best 2x MaxResults in a bounded heap; only those resolve path distance.
+ */
+UCLASS()
+class PROJECTWALKINGSIM_API UHidingSpotIndexSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+
+	/** Add a spot to the index. Called from AHidingSpotActor::BeginPlay. */
+	void RegisterSpot(AHidingSpotActor* Spot);
+
+	/** Remove a spot from the index. Called from AHidingSpotActor::EndPlay. */
+	void UnregisterSpot(AHidingSpotActor* Spot);
+
+	/**
+	 * Find the spots most worth checking near Query.Origin, best first.
+	 * @return Number of candidates written to OutCandidates.
+	 */
+	int32 FindBestSpots(const FHidingSpotQuery& Query, TArray<FHidingSpotCandidate>& OutCandidates);
+
+	/** Record that an AI has just checked this spot (lowers its priority for RecheckCooldown). */
+	void MarkChecked(const AActor* Spot);
+
+	/** Number of registered spots. */
+	int32 GetNumSpots() const { return SpotToEntry.Num(); }
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	struct FCachedPathDistance
+	{
+		float Length = 0.0f;
+		double Time = 0.0;
+	};
+
+	struct FSpotEntry
+	{
+		TWeakObjectPtr<AHidingSpotActor> Spot;
+		FVector Location = FVector::ZeroVector;
+		FGameplayTag SpotType;
+		FVector ApproachPoint = FVector::ZeroVector;
+		bool bApproachResolved = false;
+		double LastCheckedTime = -DBL_MAX;
+
+		/** Path length from a quantised origin to ApproachPoint; negative = unreachable. */
+		TMap<FIntPoint, FCachedPathDistance> PathDistances;
+	};
+
+	FIntPoint GetCell(const FVector& Location) const;
+
+	/** Project the spot's front onto the NavMesh (falls back to the spot location). */
+	void ResolveApproachPoint(FSpotEntry& Entry, const AActor* Querier) const;
+
+	/** Cached or freshly computed path length; negative if unreachable. */
+	float GetPathDistance(FSpotEntry& Entry, const FVector& Origin, const AActor* Querier, double Now) const;
+
+	/** Spot entries; removed spots leave a null slot that is reused on the next register. */
+	TArray<FSpotEntry> Entries;
+
+	TArray<int32> FreeEntries;
+
+	TMap<TWeakObjectPtr<const AActor>, int32> SpotToEntry;
+
+	/** Grid cell -> entry indices. */
+	TMap<FIntPoint, TArray<int32>> Grid;
+
+	/** Grid cell edge in cm. */
+	static constexpr float CellSize = 1000.0f;
+
+	/** Quantisation of query origins for the path-distance cache. */
+	static constexpr float PathCacheCellSize = 250.0f;
+
+	/** Cached path distances older than this are recomputed (doors change the NavMesh). */
+	static constexpr double PathCacheLifetime = 30.0;
+
+	/** Per-spot cache size cap; the cache is cleared when exceeded. */
+	static constexpr int32 MaxCachedPathsPerSpot = 16;
+
+	/** Distance in front of the spot to place the approach point. */
+	static constexpr float ApproachDistance = 120.0f;
+
+	/** Score multiplier for spots where the monster has found the player before. */
+	static constexpr float DiscoveredBonus = 1.5f;
+};
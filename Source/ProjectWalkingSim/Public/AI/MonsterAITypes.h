@@ -50,6 +50,31 @@ enum class EStimulusType : uint8
 	Sight UMETA(DisplayName = "Sight")
 };
 
+/**
+ * Simulation level of detail for a Wendigo.
+ * Full runs movement, path following, animation and perception.
+ * Virtual hides the pawn and replays patrol movement along the cached patrol graph.
+ */
+UENUM(BlueprintType)
+enum class EWendigoSimulationLOD : uint8
+{
+	Full    UMETA(DisplayName = "Full"),
+	Virtual UMETA(DisplayName = "Virtual")
+};
+
+/**
+ * How much a fully simulated Wendigo matters to what the player sees right now.
+ * Drives the Wendigo's animation budget significance (tick rate, interpolation, off-screen work).
+ */
+UENUM(BlueprintType)
+enum class EWendigoSignificanceTier : uint8
+{
+	Critical  UMETA(DisplayName = "Critical"),   // Chasing or grabbing -- every frame, even off-screen
+	Near      UMETA(DisplayName = "Near"),       // Rendered and close
+	Far       UMETA(DisplayName = "Far"),        // Rendered but distant -- throttled and interpolated
+	OffScreen UMETA(DisplayName = "Off Screen")  // Not rendered -- minimal work
+};
+
 /**
  * AI tuning constants.
  * Centralized defaults for perception, suspicion, and movement parameters.
@@ -113,4 +138,16 @@ namespace AIConstants
 
 	/** Number of random navmesh points to visit during search. */
 	constexpr int32 NumSearchPoints = 3;
+
+	/** Distance from the player in cm beyond which a patrolling Wendigo is virtualised (~50m). */
+	constexpr float VirtualizationRadius = 5000.0f;
+
+	/** Hysteresis in cm: a virtual Wendigo devirtualises at VirtualizationRadius minus this. */
+	constexpr float VirtualizationHysteresis = 500.0f;
+
+	/** Seconds between relevance checks for simulation LOD. */
+	constexpr float RelevanceCheckInterval = 0.5f;
+
+	/** Rendered Wendigos closer than this in cm are Near significance (~15m); beyond it, Far. */
+	constexpr float AnimSignificanceNearDistance = 1500.0f;
 }
@@ -0,0 +1,49 @@
+// Copyright Null Lantern.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "NavModifierQueueSubsystem.generated.h"
+
+class UOpenableNavModifierComponent;
+
+/**
+ * Rate-limited queue for runtime nav-area changes (doors, drawers).
+ *
+ * Each applied change dirties the navmesh tiles under one modifier's bounds.
+ * Slamming several doors in the same frame would otherwise rebuild all of
+ * those tiles at once. The queue drains through a token bucket: tokens refill
+ * at Serene.Nav.ModifierUpdatesPerSecond up to Serene.Nav.ModifierUpdateBurst,
+ * and each area change that actually differs from the current one costs a
+ * token. Requests are FIFO; a modifier appears at most once in the queue.
+ *
+ * Requires RecastNavMesh RuntimeGeneration=DynamicModifiersOnly (DefaultEngine.ini).
+ */
+UCLASS()
+class PROJECTWALKINGSIM_API UNavModifierQueueSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	/** Queue a modifier for a budgeted area refresh. No-op if already queued. */
+	void Enqueue(UOpenableNavModifierComponent* Modifier);
+
+	/** Number of modifiers waiting for budget. */
+	int32 GetNumPending() const { return PendingModifiers.Num(); }
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	/** FIFO of modifiers waiting to apply their desired area class. */
+	TArray<TWeakObjectPtr<UOpenableNavModifierComponent>> PendingModifiers;
+
+	/** Available rebuild tokens (token bucket). */
+	float UpdateTokens = 0.0f;
+};
@@ -0,0 +1,64 @@
+// Copyright Null Lantern.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "NavModifierComponent.h"
+#include "OpenableNavModifierComponent.generated.h"
+
+class UNavArea;
+
+/**
+ * Nav modifier whose area class follows an open/closed state.
+ *
+ * Attached to doors (and optionally large drawers) so the navmesh reflects
+ * whether the opening is passable. The owner calls SetOpenState whenever its
+ * bIsOpen flag changes; the component does not refresh navigation itself but
+ * enqueues on UNavModifierQueueSubsystem, which applies area changes under a
+ * per-second budget. Repeated toggles while queued collapse into one rebuild
+ * of the final state.
+ *
+ * Bounds come from the owner's colliding components (the frame mesh for a
+ * door), so only the tiles under the opening are rebuilt.
+ */
+UCLASS(ClassGroup = (AI), meta = (BlueprintSpawnableComponent))
+class PROJECTWALKINGSIM_API UOpenableNavModifierComponent : public UNavModifierComponent
+{
+	GENERATED_BODY()
+
+public:
+	UOpenableNavModifierComponent(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
+
+	virtual void OnRegister() override;
+
+	/** Record the owner's new open state and queue a budgeted nav refresh if the area must change. */
+	UFUNCTION(BlueprintCallable, Category = "Navigation")
+	void SetOpenState(bool bOpen);
+
+	/**
+	 * Apply the area class for the most recent desired state.
+	 * Called by UNavModifierQueueSubsystem when budget is available.
+	 * @return True if the area class changed (a tile rebuild was issued).
+	 */
+	bool ApplyDesiredAreaClass();
+
+	/** Whether this component is currently waiting in the update queue. */
+	bool IsUpdateQueued() const { return bUpdateQueued; }
+
+	/** Area applied while the owner is open. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Navigation")
+	TSubclassOf<UNavArea> OpenAreaClass;
+
+	/** Area applied while the owner is closed. Also the area baked into the static navmesh. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Navigation")
+	TSubclassOf<UNavArea> ClosedAreaClass;
+
+private:
+	friend class UNavModifierQueueSubsystem;
+
+	/** Open state requested by the owner; resolved to an area class when the queue reaches us. */
+	bool bDesiredOpen = false;
+
+	/** Guards against enqueuing the same component twice. */
+	bool bUpdateQueued = false;
+};
@@ -8,6 +8,31 @@
 
 class UBillboardComponent;
 
+/**
+ * World-space polyline with cumulative distances.
+ * Lets a virtualised Wendigo replay patrol movement from distance alone
+ * (no pathfinding or movement simulation while off-screen).
+ */
+struct PROJECTWALKINGSIM_API FPatrolPolyline
+{
+	TArray<FVector> Points;
+
+	/** CumulativeDistances[i] = path length from Points[0] to Points[i]. */
+	TArray<float> CumulativeDistances;
+
+	/** Replace the polyline points and rebuild cumulative distances. */
+	void Build(TArray<FVector>&& InPoints);
+
+	/** Total length in cm (0 for fewer than two points). */
+	float GetLength() const { return CumulativeDistances.Num() > 0 ? CumulativeDistances.Last() : 0.0f; }
+
+	/**
+	 * Point at Distance along the polyline (clamped), walking from the last point if bReverse.
+	 * @param OutDirection  Optional unit travel direction at the sampled point.
+	 */
+	FVector Sample(float Distance, bool bReverse, FVector* OutDirection = nullptr) const;
+};
+
 /**
  * Container for patrol waypoints placed in the level.
  * Each Wendigo instance references one PatrolRouteActor to define its patrol path.
@@ -59,6 +84,24 @@ public:
 	 */
 	int32 GetNextWaypointIndex(int32 CurrentIndex) const;
 
+	// --- Patrol Graph (virtualised simulation) ---
+
+	/**
+	 * Precompute NavMesh paths between adjacent waypoints (including the loop-back leg).
+	 * No-op once built. Paths are found for NavAgent's nav data (the Wendigo agent).
+	 */
+	void BuildPatrolGraph(const AActor* NavAgent);
+
+	/** Whether BuildPatrolGraph has run. */
+	bool HasPatrolGraph() const { return bPatrolGraphBuilt; }
+
+	/**
+	 * Cached path between two adjacent waypoints, in either direction.
+	 * @param bOutReverse  True if the returned polyline must be walked backwards.
+	 * @return Leg polyline, or nullptr if the indices are not adjacent or the graph is not built.
+	 */
+	const FPatrolPolyline* FindLeg(int32 FromIndex, int32 ToIndex, bool& bOutReverse) const;
+
 #if WITH_EDITOR
 	virtual void Tick(float DeltaTime) override;
 #endif
@@ -78,4 +121,9 @@ private:
 	 * but must track direction state for ping-pong mode.
 	 */
 	mutable int32 PingPongDirection = 1;
+
+	/** Legs[i] = path from waypoint i to waypoint (i + 1) % Num. Built lazily. */
+	TArray<FPatrolPolyline> Legs;
+
+	bool bPatrolGraphBuilt = false;
 };
@@ -0,0 +1,132 @@
+// Copyright Null Lantern.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+DECLARE_STATS_GROUP(TEXT("Serene AI"), STATGROUP_SereneAI, STATCAT_Advanced);
+
+/** Compiles the rolling histograms and budget checks out of Shipping. Stats/trace follow engine settings. */
+#ifndef SERENE_AI_PROFILING
+#define SERENE_AI_PROFILING !UE_BUILD_SHIPPING
+#endif
+
+/** StateTree node entry points that are profiled. */
+enum class ESereneAIProfilePhase : uint8
+{
+	EnterState,
+	Tick,
+	ExitState,
+	TestCondition,
+	Num
+};
+
+#if SERENE_AI_PROFILING
+
+/** Rolling timing samples for one StateTree task or condition. */
+struct FSereneAIProfileNode
+{
+	/** Samples kept per phase (ring buffer). */
+	static constexpr int32 WindowSize = 1024;
+
+	struct FPhaseSamples
+	{
+		/** Durations in CPU cycles; grows to WindowSize then wraps. */
+		TArray<uint32> Cycles;
+		int32 NextIndex = 0;
+		uint64 TotalCount = 0;
+		uint64 TotalCycles = 0;
+		uint32 MaxCycles = 0;
+	};
+
+	FString Name;
+	FPhaseSamples Phases[static_cast<int32>(ESereneAIProfilePhase::Num)];
+
+	/** Per-node budget in ms from Serene.AI.TaskBudgets; negative uses Serene.AI.DefaultTaskBudgetMs. */
+	float BudgetMs = -1.0f;
+
+	/** Platform seconds of the last over-budget warning (warnings are rate-limited per node). */
+	double LastBudgetWarningTime = 0.0;
+};
+
+/**
+ * Per-node profiling registry for StateTree tasks and conditions.
+ *
+ * Samples feed a rolling window per node and phase. Console:
+ *   Serene.AI.ProfileDump   -- count/avg/p50/p95/max and a log2 microsecond histogram
+ *   Serene.AI.ProfileReset  -- clear all windows
+ * CVars:
+ *   Serene.AI.Profile                 -- enable sampling (default 1)
+ *   Serene.AI.DefaultTaskBudgetMs     -- warn when any node call exceeds this (0 = off)
+ *   Serene.AI.TaskBudgets             -- per-node overrides, e.g. "STT_SearchArea=0.5,STC_SuspicionLevel=0.05"
+ * Over-budget calls log a warning and drop an Insights bookmark.
+ */
+namespace SereneAIProfiling
+{
+	/** Find or create the node for Name. The returned reference stays valid for the process lifetime. */
+	PROJECTWALKINGSIM_API FSereneAIProfileNode& RegisterNode(const TCHAR* Name);
+
+	/** Whether samples are being recorded (Serene.AI.Profile). */
+	PROJECTWALKINGSIM_API bool IsEnabled();
+
+	/** Record one call duration and check it against the node's budget. Game thread only. */
+	PROJECTWALKINGSIM_API void RecordSample(FSereneAIProfileNode& Node, ESereneAIProfilePhase Phase, uint32 Cycles);
+
+	/** Visit every registered node (e.g., to export totals). */
+	PROJECTWALKINGSIM_API void ForEachNode(TFunctionRef<void(const FSereneAIProfileNode&)> Visitor);
+
+	/** Clear all rolling windows and totals. */
+	PROJECTWALKINGSIM_API void ResetAll();
+
+	/** Display name of a phase. */
+	PROJECTWALKINGSIM_API const TCHAR* GetPhaseName(ESereneAIProfilePhase Phase);
+}
+
+/** RAII timer feeding SereneAIProfiling::RecordSample. */
+class FSereneAIProfileScope
+{
+public:
+	FSereneAIProfileScope(FSereneAIProfileNode& InNode, ESereneAIProfilePhase InPhase)
+		: Node(InNode)
+		, Phase(InPhase)
+		, bActive(SereneAIProfiling::IsEnabled())
+		, StartCycles(bActive ? FPlatformTime::Cycles() : 0)
+	{
+	}
+
+	~FSereneAIProfileScope()
+	{
+		if (bActive)
+		{
+			SereneAIProfiling::RecordSample(Node, Phase, FPlatformTime::Cycles() - StartCycles);
+		}
+	}
+
+private:
+	FSereneAIProfileNode& Node;
+	ESereneAIProfilePhase Phase;
+	bool bActive;
+	uint32 StartCycles;
+};
+
+#define SERENE_AI_PROFILE_HISTOGRAM_SCOPE(NodeName, Phase) \
+	static FSereneAIProfileNode& SereneAIProfileNode_##Phase = SereneAIProfiling::RegisterNode(TEXT(#NodeName)); \
+	FSereneAIProfileScope SereneAIProfileScope_##Phase(SereneAIProfileNode_##Phase, ESereneAIProfilePhase::Phase)
+
+#else
+
+#define SERENE_AI_PROFILE_HISTOGRAM_SCOPE(NodeName, Phase)
+
+#endif // SERENE_AI_PROFILING
+
+/**
+ * Instrument a StateTree task/condition entry point:
+ * cycle stat (stat SereneAI), Insights CPU event, and rolling histogram + budget check.
+ * Usage: SERENE_AI_PROFILE_SCOPE(STT_ChasePlayer, Tick);
+ */
+#define SERENE_AI_PROFILE_SCOPE(NodeName, Phase) \
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT(#NodeName "::" #Phase), STAT_##NodeName##_##Phase, STATGROUP_SereneAI); \
+	TRACE_CPUPROFILER_EVENT_SCOPE(NodeName##_##Phase); \
+	SERENE_AI_PROFILE_HISTOGRAM_SCOPE(NodeName, Phase)
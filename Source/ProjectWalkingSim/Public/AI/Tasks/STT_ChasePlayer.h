@@ -7,6 +7,7 @@
 #include "StateTreeLinker.h"
 #include "StateTreeExecutionContext.h"
 #include "AI/MonsterAITypes.h"
+#include "AI/WendigoChasePlanner.h"
 #include "STT_ChasePlayer.generated.h"
 
 class AAIController;
@@ -14,7 +15,7 @@ class AAIController;
 /**
  * Instance data for FSTT_ChasePlayer.
  * Tracks per-instance runtime state for the chase behavior:
- * LOS lost timer, move request status, and cached chase target.
+ * LOS lost timer, move request status, cached chase target and path planner.
  */
 USTRUCT()
 struct PROJECTWALKINGSIM_API FSTT_ChasePlayerInstanceData
@@ -35,14 +36,21 @@ struct PROJECTWALKINGSIM_API FSTT_ChasePlayerInstanceData
 
 	/** Cached reference to the player pawn being chased. */
 	TWeakObjectPtr<AActor> ChaseTarget;
+
+	/** Intercept goal selection and throttled async repathing. */
+	FWendigoChasePlanner Planner;
+
+	/** Seconds since EnterState (for query-rate logging). */
+	float ChaseElapsed = 0.0f;
 };
 
 /**
- * State Tree task: chase the player at high speed using MoveToActor.
+ * State Tree task: chase the player at high speed toward a predicted intercept point.
  *
  * On EnterState, sets the Wendigo's BehaviorState to Chasing, increases
  * walk speed to ChaseSpeed (575 cm/s), acquires the player pawn as a
- * chase target, and issues MoveToActor for continuous path updates.
+ * chase target, and moves toward where the player will be (position plus
+ * velocity, up to MaxPredictionTime ahead).
  *
  * On Tick:
  *   - Monitors line-of-sight. While visible, resets the LOS timer and
@@ -51,8 +59,11 @@ struct PROJECTWALKINGSIM_API FSTT_ChasePlayerInstanceData
  *     returns Failed (triggers transition to Search state).
  *   - Checks grab range. If within GrabRange (150cm) AND has LOS,
  *     returns Succeeded (triggers transition to GrabAttack state).
- *   - Re-issues MoveToActor if the path following system goes idle
- *     mid-chase (handles player leaving NavMesh temporarily).
+ *   - Recomputes the intercept goal. The current path is reused while the
+ *     goal stays within a tolerance of its end (GoalTolerance, widened by
+ *     GoalToleranceDistanceScale with distance to the player). Otherwise,
+ *     or when path following goes idle, an async path query is issued at
+ *     most every MinRepathInterval and swapped in when it completes.
  *
  * On ExitState, restores WendigoWalkSpeed, stops movement, and clears focus.
  */
@@ -98,6 +109,22 @@ struct PROJECTWALKINGSIM_API FSTT_ChasePlayer : public FStateTreeTaskCommonBase
 	UPROPERTY(EditAnywhere, Category = "Chase", meta = (ClampMin = "10.0"))
 	float AcceptanceRadius = 50.0f;
 
+	/** Maximum lookahead in seconds when predicting the player's intercept point. 0 chases the current position. */
+	UPROPERTY(EditAnywhere, Category = "Chase|Pathing", meta = (ClampMin = "0.0", ClampMax = "3.0"))
+	float MaxPredictionTime = 1.0f;
+
+	/** Goal drift in cm below which the current path is reused. */
+	UPROPERTY(EditAnywhere, Category = "Chase|Pathing", meta = (ClampMin = "10.0"))
+	float GoalTolerance = 100.0f;
+
+	/** Extra reuse tolerance per cm of distance to the player (far goals need less precision). */
+	UPROPERTY(EditAnywhere, Category = "Chase|Pathing", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+	float GoalToleranceDistanceScale = 0.2f;
+
+	/** Minimum seconds between path queries. */
+	UPROPERTY(EditAnywhere, Category = "Chase|Pathing", meta = (ClampMin = "0.05"))
+	float MinRepathInterval = 0.3f;
+
 	/** Interval in seconds between LineOfSightTo trace checks. */
 	UPROPERTY(EditAnywhere, Category = "Chase", meta = (ClampMin = "0.05", ClampMax = "0.5"))
 	float LOSCheckInterval = 0.15f;
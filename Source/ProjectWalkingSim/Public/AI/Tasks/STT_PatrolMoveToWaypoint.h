@@ -9,6 +9,7 @@
 #include "STT_PatrolMoveToWaypoint.generated.h"
 
 class AAIController;
+class AWendigoCharacter;
 
 /**
  * Instance data for FSTT_PatrolMoveToWaypoint.
@@ -30,6 +31,8 @@ struct PROJECTWALKINGSIM_API FSTT_PatrolMoveToWaypointInstanceData
  * On EnterState, reads the target waypoint from the pawn's PatrolRoute actor
  * and issues AAIController::MoveToLocation. On Tick, polls GetMoveStatus()
  * and returns Succeeded once the AI reaches the waypoint (advancing the index).
+ * Entered while the Wendigo is dormant (State Tree started paused), the move is
+ * deferred to the first Tick after waking.
  *
  * Designed to alternate with STT_PatrolIdle in a patrol loop:
  *   [MoveToWaypoint] -> Succeeded -> [Idle] -> Succeeded -> [MoveToWaypoint] -> ...
@@ -57,6 +60,10 @@ struct PROJECTWALKINGSIM_API FSTT_PatrolMoveToWaypoint : public FStateTreeTaskCo
 	virtual void ExitState(FStateTreeExecutionContext& Context,
 		const FStateTreeTransitionResult& Transition) const override;
 
+	/** Issue the move to the current waypoint (Succeeded and index advanced if already there). */
+	EStateTreeRunStatus RequestMove(AAIController& Controller, AWendigoCharacter& Wendigo,
+		FInstanceDataType& InstanceData) const;
+
 	/** External data handle for the AI controller. Linked automatically by the StateTreeAIComponentSchema. */
 	TStateTreeExternalDataHandle<AAIController> ControllerHandle;
 
@@ -7,6 +7,7 @@
 #include "StateTreeLinker.h"
 #include "StateTreeExecutionContext.h"
 #include "AI/MonsterAITypes.h"
+#include "GameplayTagContainer.h"
 #include "STT_SearchArea.generated.h"
 
 class AAIController;
@@ -21,9 +22,12 @@ struct PROJECTWALKINGSIM_API FSTT_SearchAreaInstanceData
 {
 	GENERATED_BODY()
 
-	/** Ordered list of world-space search points (last-known + random NavMesh points). */
+	/** Ordered list of world-space search points (last-known + hiding spots + random NavMesh points). */
 	TArray<FVector> SearchPoints;
 
+	/** Parallel to SearchPoints: the hiding spot a point approaches, or null for area points. */
+	TArray<TWeakObjectPtr<AActor>> SearchPointSpots;
+
 	/** Index into SearchPoints for the current navigation target. */
 	int32 CurrentSearchIndex = 0;
 
@@ -44,13 +48,16 @@ struct PROJECTWALKINGSIM_API FSTT_SearchAreaInstanceData
  * State Tree task: search the area around the player's last-known location.
  *
  * On EnterState, builds a search point list starting with the Wendigo's
- * LastKnownPlayerLocation (or current position as fallback), then generates
+ * LastKnownPlayerLocation (or current position as fallback), then adds the
+ * approach points of up to NumHidingSpotsToCheck hiding spots ranked by
+ * UHidingSpotIndexSubsystem (witnessed spot first), then generates
  * NumRandomPoints additional points via GetRandomReachablePointInRadius.
  * Sets BehaviorState to Searching and MaxWalkSpeed to SearchSpeed (180 cm/s).
  *
  * On Tick, navigates through each search point sequentially. After arriving
  * at each point, lingers for LingerDuration seconds with periodic look-around
- * head turns (similar to STT_PatrolIdle pattern). After visiting all points
+ * head turns (similar to STT_PatrolIdle pattern); at a hiding spot it stares
+ * at the spot instead and marks it checked when done. After visiting all points
  * or after MaxSearchDuration expires, returns Succeeded.
  *
  * On ExitState, restores WendigoWalkSpeed, stops movement, clears focus,
@@ -95,6 +102,18 @@ struct PROJECTWALKINGSIM_API FSTT_SearchArea : public FStateTreeTaskCommonBase
 	UPROPERTY(EditAnywhere, Category = "Search", meta = (ClampMin = "1", ClampMax = "6"))
 	int32 NumRandomPoints = AIConstants::NumSearchPoints;
 
+	/** Hiding spots near the search origin to check before the random points. */
+	UPROPERTY(EditAnywhere, Category = "Search|Hiding Spots", meta = (ClampMin = "0", ClampMax = "4"))
+	int32 NumHidingSpotsToCheck = 2;
+
+	/** Priority multiplier per hiding spot type (HidingSpot.Locker, ...). Unlisted types use 1. */
+	UPROPERTY(EditAnywhere, Category = "Search|Hiding Spots")
+	TMap<FGameplayTag, float> SpotTypeWeights;
+
+	/** Seconds after a spot was checked before it regains full priority. */
+	UPROPERTY(EditAnywhere, Category = "Search|Hiding Spots", meta = (ClampMin = "0.0"))
+	float SpotRecheckCooldown = 60.0f;
+
 	/** Total search duration in seconds before returning Succeeded. */
 	UPROPERTY(EditAnywhere, Category = "Search", meta = (ClampMin = "5.0"))
 	float MaxSearchDuration = AIConstants::SearchDuration;
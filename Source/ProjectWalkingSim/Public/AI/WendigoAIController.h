@@ -49,6 +49,20 @@ class PROJECTWALKINGSIM_API AWendigoAIController : public AAIController
 public:
 	AWendigoAIController();
 
+	/**
+	 * Suspend or resume all controller-side simulation (simulation LOD, pooling).
+	 * Suspending stops movement, State Tree logic, perception senses, path following
+	 * and controller tick. Resuming restarts State Tree logic from its root state.
+	 * @param bPauseStateTree  Suspending only: restart the State Tree from its root now and
+	 *                         pause it, so resuming just unpauses it (no StartLogic when a
+	 *                         pooled Wendigo is activated). Also applies if the controller has
+	 *                         not begun play yet: the tree starts paused.
+	 */
+	void SetSimulationSuspended(bool bSuspended, bool bPauseStateTree = false);
+
+	/** Whether controller-side simulation is currently suspended. */
+	bool IsSimulationSuspended() const { return bSimulationSuspended; }
+
 protected:
 	virtual void BeginPlay() override;
 	virtual void Tick(float DeltaTime) override;
@@ -81,13 +95,19 @@ private:
 	/** Process a hearing perception event. Feeds SuspicionComponent immediately. */
 	void ProcessHearingPerception(AActor* NoiseInstigator, FVector StimulusLocation);
 
-	/** Starts State Tree logic only when both BeginPlay and OnPossess have completed. */
+	/** Starts State Tree logic only when both BeginPlay and OnPossess have completed (paused if suspended with bPauseStateTree). */
 	void TryStartStateTree();
 
 	/** Two-flag guard for safe StartLogic timing. */
 	bool bBeginPlayCalled = false;
 	bool bPossessCalled = false;
 
+	/** Set by SetSimulationSuspended; blocks TryStartStateTree while virtualised. */
+	bool bSimulationSuspended = false;
+
+	/** Suspended with bPauseStateTree: TryStartStateTree starts the tree paused instead of not at all. */
+	bool bPauseStateTreeWhileSuspended = false;
+
 	/** Debug timer for periodic sight logging (avoids log spam). */
 	float SightDebugTimer = 0.0f;
 
@@ -13,12 +13,18 @@ class APatrolRouteActor;
 class AHidingSpotActor;
 class UMonsterAudioComponent;
 class UMusicTensionSystem;
+class UWendigoSimulationLODComponent;
 
 /**
  * The Wendigo monster character.
  * A tall (~260cm / ~8.5ft), slow-moving AI pawn that patrols the environment.
  * Carries a SuspicionComponent for gradual player detection and a PatrolRoute
  * reference for waypoint-based patrol behavior.
+ * A WendigoSimulationLODComponent virtualises the Wendigo while it patrols
+ * far from the player (hidden, no movement/perception/State Tree), and
+ * sets the animation budget significance of the mesh while fully simulated.
+ * The mesh is a USkeletalMeshComponentBudgeted registered with the world's
+ * animation budget allocator (Serene.Anim.BudgetMs).
  *
  * No skeletal mesh is assigned in C++ -- a Blueprint subclass will assign
  * the appropriate mesh and animations in a later plan.
@@ -29,7 +35,7 @@ class PROJECTWALKINGSIM_API AWendigoCharacter : public ACharacter
 	GENERATED_BODY()
 
 public:
-	AWendigoCharacter();
+	AWendigoCharacter(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
 
 	/** Get the suspicion tracking component. */
 	UFUNCTION(BlueprintCallable, Category = "AI")
@@ -97,6 +103,31 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Audio")
 	UMusicTensionSystem* GetMusicTensionSystem() const { return MusicTensionSystem; }
 
+	/**
+	 * Enable/disable pawn-side simulation: visibility, collision, CharacterMovement,
+	 * mesh tick and monster audio. Controller-side state is left untouched.
+	 */
+	void SetPawnSimulationEnabled(bool bEnabled);
+
+	/**
+	 * Park or wake a pooled Wendigo (see UWendigoPoolSubsystem).
+	 * Dormant: hidden, no collision/movement/animation/audio, perception off, simulation LOD
+	 * checks paused. The State Tree is restarted from its root and paused when parking (or
+	 * starts paused if parked before BeginPlay), so waking only unpauses it.
+	 */
+	void SetDormant(bool bNewDormant);
+
+	/** Clear suspicion, chase memory and behavior state back to a fresh Patrol (pool reuse, soak episodes). */
+	void ResetAIState();
+
+	/** Whether this Wendigo is parked in the pool. */
+	UFUNCTION(BlueprintCallable, Category = "AI")
+	bool IsDormant() const { return bDormant; }
+
+	/** Get the simulation LOD component (off-screen virtualisation). */
+	UFUNCTION(BlueprintCallable, Category = "AI")
+	UWendigoSimulationLODComponent* GetSimulationLODComponent() const { return SimulationLODComponent; }
+
 protected:
 	/** Suspicion component -- tracks detection state and alert levels. */
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "AI")
@@ -110,10 +141,18 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Audio")
 	TObjectPtr<UMusicTensionSystem> MusicTensionSystem;
 
+	/** Switches between full and virtualised (off-screen patrol) simulation. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "AI")
+	TObjectPtr<UWendigoSimulationLODComponent> SimulationLODComponent;
+
 	/**
 	 * Patrol route for this Wendigo instance.
 	 * Set per-instance in the level editor to link a Wendigo to its waypoint route.
 	 */
 	UPROPERTY(EditInstanceOnly, BlueprintReadOnly, Category = "AI|Patrol")
 	TObjectPtr<APatrolRouteActor> PatrolRoute;
+
+private:
+	/** Set by SetDormant. */
+	bool bDormant = false;
 };
@@ -0,0 +1,78 @@
+// Copyright Null Lantern.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "NavigationSystemTypes.h"
+
+class AAIController;
+
+/**
+ * Goal selection and repath throttling for FSTT_ChasePlayer.
+ *
+ * Aims at a predicted intercept point (target position + velocity * time to
+ * reach it at chase speed) instead of the target's current position, and only
+ * replans when that goal has drifted past a distance-scaled tolerance and the
+ * minimum repath interval has elapsed. Replans are async (FindPathAsync);
+ * the current path keeps being followed until the new one is ready.
+ *
+ * Lives in task instance data. Async results are delivered through a shared
+ * slot so the planner itself may be moved or destroyed while a query is in flight.
+ */
+struct PROJECTWALKINGSIM_API FWendigoChasePlanner
+{
+	/**
+	 * Point where a chaser at ChaserLocation moving at ChaserSpeed meets a target moving
+	 * at constant horizontal velocity. Lookahead is clamped to MaxPredictionTime.
+	 */
+	static FVector PredictInterceptPoint(const FVector& ChaserLocation, float ChaserSpeed,
+		const FVector& TargetLocation, const FVector& TargetVelocity, float MaxPredictionTime);
+
+	/** Drop any in-flight query and forget the current goal. */
+	void Reset();
+
+	/** Record a goal that was pathed synchronously (e.g., the initial MoveTo on chase entry). */
+	void SetCurrentGoal(const FVector& Goal, double Now);
+
+	/**
+	 * Whether a new path should be requested for NewGoal.
+	 * @param GoalTolerance  Drift (cm) below which the current path is reused.
+	 * @param bPathIdle      True if path following stopped (end reached or aborted).
+	 */
+	bool ShouldRepath(const FVector& NewGoal, double Now, float GoalTolerance, float MinRepathInterval, bool bPathIdle) const;
+
+	/** Start an async path query from the controller's pawn to Goal. @return False if no query could be issued. */
+	bool RequestPathAsync(AAIController& Controller, const FVector& Goal, double Now);
+
+	/** Whether an async query is in flight. */
+	bool IsQueryPending() const;
+
+	/**
+	 * Take the result of the last async query, once.
+	 * @param OutPath  Valid path on success; null if the query failed.
+	 * @return True if a query completed since the last call.
+	 */
+	bool ConsumeResult(FNavPathSharedPtr& OutPath);
+
+	/** Goal of the path currently being followed (or requested). */
+	const FVector& GetCurrentGoal() const { return CurrentGoal; }
+
+	/** Path queries issued since the last Reset (sync + async). */
+	int32 GetNumQueries() const { return NumQueries; }
+
+private:
+	/** Written by the async callback, read by ConsumeResult. */
+	struct FAsyncResultSlot
+	{
+		uint32 QueryId = 0;
+		bool bComplete = false;
+		FNavPathSharedPtr Path;
+	};
+
+	TSharedPtr<FAsyncResultSlot> PendingResult;
+
+	FVector CurrentGoal = FVector::ZeroVector;
+	bool bHasGoal = false;
+	double LastRepathTime = -DBL_MAX;
+	int32 NumQueries = 0;
+};
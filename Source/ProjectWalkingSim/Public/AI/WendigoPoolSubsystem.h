@@ -0,0 +1,74 @@
+// Copyright Null Lantern.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "WendigoPoolSubsystem.generated.h"
+
+class AWendigoCharacter;
+class APatrolRouteActor;
+
+/** Dormant Wendigos of one class. */
+USTRUCT()
+struct FWendigoPoolBucket
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<TObjectPtr<AWendigoCharacter>> Dormant;
+};
+
+/**
+ * Pool of pre-spawned, dormant Wendigos.
+ *
+ * Spawning a Wendigo mid-game pays for actor construction, component
+ * registration, AIController spawn/possession, State Tree initialisation and
+ * perception registration on one frame. Prewarm pays all of that during level
+ * load (called from AWendigoSpawnPoint::BeginPlay), then parks each instance
+ * with AWendigoCharacter::SetDormant(true), which leaves its State Tree
+ * started and paused.
+ *
+ * Acquire wakes a parked instance: reset AI state, teleport, assign route,
+ * SetDormant(false), which only unpauses the State Tree. If the pool for a class is empty it falls back to a
+ * regular spawn and logs a warning so PoolSize can be raised.
+ */
+UCLASS()
+class PROJECTWALKINGSIM_API UWendigoPoolSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+
+	/**
+	 * Spawn Count additional Wendigos of WendigoClass and park them dormant at ParkTransform.
+	 * Intended for level load only.
+	 */
+	void Prewarm(TSubclassOf<AWendigoCharacter> WendigoClass, int32 Count, const FTransform& ParkTransform);
+
+	/**
+	 * Take a Wendigo from the pool and activate it at the given transform.
+	 * @param Route  Patrol route to assign before logic restarts (may be null).
+	 * @return The active Wendigo, or nullptr if the fallback spawn failed.
+	 */
+	AWendigoCharacter* Acquire(TSubclassOf<AWendigoCharacter> WendigoClass,
+		const FVector& Location, const FRotator& Rotation, APatrolRouteActor* Route);
+
+	/** Return an active Wendigo to the pool (made dormant in place). */
+	UFUNCTION(BlueprintCallable, Category = "AI|Spawn")
+	void Release(AWendigoCharacter* Wendigo);
+
+	/** Number of dormant Wendigos available for WendigoClass. */
+	int32 GetNumDormant(TSubclassOf<AWendigoCharacter> WendigoClass) const;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	/** Spawn one fully initialised Wendigo (BeginPlay + possession complete). */
+	AWendigoCharacter* SpawnInstance(TSubclassOf<AWendigoCharacter> WendigoClass, const FTransform& Transform) const;
+
+	UPROPERTY()
+	TMap<TObjectPtr<UClass>, FWendigoPoolBucket> Buckets;
+};
@@ -0,0 +1,141 @@
+// Copyright Null Lantern.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "AI/MonsterAITypes.h"
+#include "AI/PatrolRouteActor.h"
+#include "WendigoSimulationLODComponent.generated.h"
+
+class AWendigoCharacter;
+
+/**
+ * Switches a patrolling Wendigo between full and virtualised simulation.
+ *
+ * Every RelevanceCheckInterval seconds, compares the Wendigo's distance to the
+ * player against VirtualizationRadius. A Wendigo that is beyond the radius,
+ * not rendered, in Patrol behavior and at Patrol alert level is virtualised:
+ *   - State Tree logic, path following, perception and controller tick stop
+ *   - Pawn is hidden, collision and CharacterMovement are disabled
+ *   - Skeletal mesh stops ticking, monster audio is suspended
+ *
+ * While virtual, position is a pure function of elapsed time along the
+ * route's cached patrol graph (APatrolRouteActor::BuildPatrolGraph): walk
+ * each leg at WendigoWalkSpeed, pause VirtualIdleDuration at each waypoint,
+ * advance CurrentWaypointIndex exactly as STT_PatrolMoveToWaypoint does.
+ *
+ * On re-entering relevance (radius minus hysteresis) the pawn is placed at
+ * the interpolated point on the navmesh path, facing along it, and State Tree
+ * logic restarts from the root -- Patrol resumes toward CurrentWaypointIndex.
+ *
+ * While fully simulated, the same check assigns an EWendigoSignificanceTier
+ * (also re-evaluated on every behavior state change) and forwards it to the
+ * budgeted mesh. The world's animation budget allocator then spends
+ * Serene.Anim.BudgetMs across all Wendigos: Critical never skips frames,
+ * Near ticks at full rate under budget, Far is throttled with interpolation,
+ * OffScreen does minimal work. Hidden meshes are not skinned, so skinning
+ * cost follows rendering.
+ *
+ * No Tick: fully timer-driven.
+ */
+UCLASS(ClassGroup = (AI), meta = (BlueprintSpawnableComponent))
+class PROJECTWALKINGSIM_API UWendigoSimulationLODComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	UWendigoSimulationLODComponent();
+
+	/** Current simulation level of detail. */
+	UFUNCTION(BlueprintCallable, Category = "AI|SimulationLOD")
+	EWendigoSimulationLOD GetSimulationLOD() const { return SimulationLOD; }
+
+	UFUNCTION(BlueprintCallable, Category = "AI|SimulationLOD")
+	bool IsVirtualized() const { return SimulationLOD == EWendigoSimulationLOD::Virtual; }
+
+	/** Current animation significance tier (meaningful only while fully simulated). */
+	UFUNCTION(BlueprintCallable, Category = "AI|SimulationLOD")
+	EWendigoSignificanceTier GetSignificanceTier() const { return SignificanceTier; }
+
+	/** Immediately return to full simulation (e.g., scripted event needs the real actor). */
+	UFUNCTION(BlueprintCallable, Category = "AI|SimulationLOD")
+	void ForceFullSimulation();
+
+	/** Pause or resume the relevance timer (dormant pooled Wendigos do not need checks). */
+	void SetRelevanceChecksPaused(bool bPaused);
+
+	/** If false, this Wendigo is never virtualised. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI|SimulationLOD")
+	bool bAllowVirtualization = true;
+
+	/** Distance from the player in cm beyond which the Wendigo may be virtualised. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "AI|SimulationLOD", meta = (ClampMin = "1000.0"))
+	float VirtualizationRadius = AIConstants::VirtualizationRadius;
+
+	/** A virtual Wendigo devirtualises at VirtualizationRadius minus this distance. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "AI|SimulationLOD", meta = (ClampMin = "0.0"))
+	float VirtualizationHysteresis = AIConstants::VirtualizationHysteresis;
+
+	/** Seconds between relevance checks. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "AI|SimulationLOD", meta = (ClampMin = "0.1"))
+	float RelevanceCheckInterval = AIConstants::RelevanceCheckInterval;
+
+	/** Pause at each waypoint while virtual. Midpoint of STT_PatrolIdle's default 3-6s range. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "AI|SimulationLOD", meta = (ClampMin = "0.0"))
+	float VirtualIdleDuration = 4.5f;
+
+	/** Rendered Wendigos closer than this in cm get Near animation significance; farther ones get Far. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "AI|SimulationLOD", meta = (ClampMin = "0.0"))
+	float NearSignificanceDistance = AIConstants::AnimSignificanceNearDistance;
+
+protected:
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+private:
+	/** Timer callback: advance virtual movement and switch LOD if relevance changed. */
+	void EvaluateRelevance();
+
+	/** Recompute the significance tier and push it to the budgeted mesh. */
+	void UpdateSignificance(AWendigoCharacter* Wendigo, const APawn* PlayerPawn);
+
+	/** Critical states must not wait for the next relevance check. */
+	UFUNCTION()
+	void HandleBehaviorStateChanged(EWendigoBehaviorState NewState);
+
+	/** Whether the Wendigo is in a state that can be virtualised right now. */
+	bool CanVirtualize(const AWendigoCharacter* Wendigo) const;
+
+	void EnterVirtual(AWendigoCharacter* Wendigo);
+	void ExitVirtual(AWendigoCharacter* Wendigo);
+
+	/** Advance virtual patrol by DeltaSeconds and place the hidden pawn at the result. */
+	void AdvanceVirtual(AWendigoCharacter* Wendigo, float DeltaSeconds);
+
+	/** Polyline for the leg currently being walked (entry leg or a cached route leg). */
+	const FPatrolPolyline* GetCurrentLeg(const AWendigoCharacter* Wendigo, bool& bOutReverse) const;
+
+	EWendigoSimulationLOD SimulationLOD = EWendigoSimulationLOD::Full;
+
+	EWendigoSignificanceTier SignificanceTier = EWendigoSignificanceTier::Near;
+
+	FTimerHandle RelevanceTimerHandle;
+
+	// --- Virtual patrol state ---
+
+	/** Path from where the pawn was virtualised to its target waypoint. */
+	FPatrolPolyline EntryLeg;
+
+	/** Waypoint the current leg starts from; INDEX_NONE while walking EntryLeg. */
+	int32 VirtualFromIndex = INDEX_NONE;
+
+	/** Distance walked along the current leg in cm. */
+	float VirtualLegDistance = 0.0f;
+
+	/** Remaining pause at the last reached waypoint. */
+	float VirtualIdleRemaining = 0.0f;
+
+	/** World time of the last virtual advance. */
+	double LastVirtualUpdateTime = 0.0;
+};
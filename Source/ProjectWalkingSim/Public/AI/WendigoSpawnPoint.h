@@ -14,9 +14,12 @@ class UBillboardComponent;
  * Spawn point for Wendigo characters with zone-based patrol route assignment.
  *
  * Place in the level and assign one or more AvailablePatrolRoutes.
- * SpawnWendigo() creates a Wendigo at this actor's transform and assigns
+ * SpawnWendigo() activates a Wendigo at this actor's transform and assigns
  * a randomly selected patrol route from the available routes.
  *
+ * On BeginPlay, PoolSize Wendigos are pre-spawned dormant into
+ * UWendigoPoolSubsystem so SpawnWendigo does not hitch mid-game.
+ *
  * Multiple spawn points with different patrol route sets enable zone-based
  * AI population (WNDG-06).
  */
@@ -29,13 +32,16 @@ public:
 	AWendigoSpawnPoint();
 
 	/**
-	 * Spawn a Wendigo at this spawn point's location and assign a random patrol route.
+	 * Activate a pooled Wendigo at this spawn point's location and assign a random patrol route.
+	 * Falls back to a runtime spawn if the pool is empty.
 	 * @return The spawned Wendigo character, or nullptr if WendigoClass is not set.
 	 */
 	UFUNCTION(BlueprintCallable, Category = "AI|Spawn")
 	AWendigoCharacter* SpawnWendigo();
 
 protected:
+	virtual void BeginPlay() override;
+
 	/** Patrol routes available to Wendigos spawned from this point. One is randomly selected per spawn. */
 	UPROPERTY(EditInstanceOnly, BlueprintReadOnly, Category = "AI|Spawn")
 	TArray<TObjectPtr<APatrolRouteActor>> AvailablePatrolRoutes;
@@ -44,6 +50,13 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "AI|Spawn")
 	TSubclassOf<AWendigoCharacter> WendigoClass;
 
+	/**
+	 * Dormant Wendigos pre-spawned at level load for this point's SpawnWendigo calls.
+	 * 0 disables pooling (every spawn pays full actor construction).
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "AI|Spawn", meta = (ClampMin = "0"))
+	int32 PoolSize = 1;
+
 #if WITH_EDITORONLY_DATA
 	/** Billboard sprite for level-editor placement visibility. */
 	UPROPERTY(VisibleAnywhere, Category = "AI|Spawn")
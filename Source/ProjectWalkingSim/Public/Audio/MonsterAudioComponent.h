@@ -32,6 +32,12 @@ class PROJECTWALKINGSIM_API UMonsterAudioComponent : public UActorComponent
 public:
 	UMonsterAudioComponent();
 
+	/**
+	 * Silence all monster audio while the owner is virtualised (off-screen simulation).
+	 * Stops breathing and the footstep timer; resuming restores both for the current behavior state.
+	 */
+	void SetAudioSuspended(bool bSuspended);
+
 protected:
 	virtual void BeginPlay() override;
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
@@ -72,6 +78,9 @@ private:
 	/** Timer handle for footstep playback at intervals. */
 	FTimerHandle FootstepTimerHandle;
 
+	/** True while suspended by SetAudioSuspended; blocks state-change audio. */
+	bool bAudioSuspended = false;
+
 	// --- Delegate handler ---
 
 	/** Called when the owning WendigoCharacter changes behavior state. */
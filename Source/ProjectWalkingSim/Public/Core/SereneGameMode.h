@@ -18,6 +18,7 @@ class UUserWidget;
  * Handles:
  * - Player death (Wendigo grab) -> Game Over screen
  * - Post-level-reload save data application via OnActorsInitialized
+ * - Starting the SaveSubsystem's timed checkpoints on BeginPlay
  */
 UCLASS()
 class PROJECTWALKINGSIM_API ASereneGameMode : public AGameModeBase
@@ -28,6 +29,7 @@ public:
 	ASereneGameMode();
 
 	virtual void InitGame(const FString& MapName, const FString& Options, FString& ErrorMessage) override;
+	virtual void BeginPlay() override;
 
 	/**
 	 * Called when the player dies (e.g., Wendigo grab completes).
@@ -36,6 +38,9 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Game")
 	void OnPlayerDeath();
 
+	/** Remove the Game Over screen and return to gameplay input (in-place restore). */
+	void ClearGameOver();
+
 	/** Returns true if the Game Over screen is currently displayed. */
 	UFUNCTION(BlueprintCallable, Category = "Game")
 	bool IsGameOver() const { return GameOverWidgetInstance != nullptr; }
@@ -7,6 +7,8 @@
 #include "Interaction/SaveableInterface.h"
 #include "DoorActor.generated.h"
 
+class UOpenableNavModifierComponent;
+
 /**
  * Animated door that opens and closes on interaction.
  *
@@ -18,6 +20,10 @@
  * require a specific key item to unlock. The key is consumed on unlock.
  *
  * Uses tick-based FInterpTo for smooth rotation animation.
+ *
+ * The panel does not affect navigation directly (rotating it would dirty
+ * navmesh tiles every animation frame). Instead NavModifier switches the
+ * doorway's area class with bIsOpen through the budgeted nav update queue.
  */
 UCLASS()
 class PROJECTWALKINGSIM_API ADoorActor : public AInteractableBase, public ISaveable
@@ -27,6 +33,7 @@ class PROJECTWALKINGSIM_API ADoorActor : public AInteractableBase, public ISavea
 public:
 	ADoorActor();
 
+	virtual void BeginPlay() override;
 	virtual void Tick(float DeltaTime) override;
 
 protected:
@@ -38,6 +45,10 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Door")
 	TObjectPtr<UStaticMeshComponent> DoorMesh;
 
+	/** Marks the doorway passable while open and blocked while closed. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Door|Navigation")
+	TObjectPtr<UOpenableNavModifierComponent> NavModifier;
+
 	/** Angle in degrees the door opens to. */
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Door")
 	float OpenAngle = 90.0f;
@@ -56,8 +67,8 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Door")
 	FName RequiredItemId = NAME_None;
 
-	/** Whether the door is currently locked. Key is consumed on unlock. */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Door")
+	/** Whether the door is currently locked. Key is consumed on unlock. Change at runtime with SetLocked. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Door")
 	bool bIsLocked = false;
 
 	/** Text shown when the door is locked. */
@@ -76,6 +87,9 @@ protected:
 	/** Direction multiplier: +1 or -1 based on which side the player approached. */
 	float OpenDirection = 1.0f;
 
+	/** bIsLocked as placed in the level, cached in BeginPlay. Doors still in their level state are not saved. */
+	bool bLockedAtLevelStart = false;
+
 public:
 	/**
 	 * Open this door for an AI actor. AI cannot open locked doors.
@@ -84,8 +98,17 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Door")
 	void OpenForAI(AActor* AIActor);
 
+	/** Lock or unlock the door (scripted events). Marks the door for the next save. */
+	UFUNCTION(BlueprintCallable, Category = "Door")
+	void SetLocked(bool bNewLocked);
+
 	// --- ISaveable ---
 	virtual FName GetSaveId_Implementation() const override;
 	virtual void WriteSaveData_Implementation(USereneSaveGame* SaveGame) override;
 	virtual void ReadSaveData_Implementation(USereneSaveGame* SaveGame) override;
+	virtual void ResetToLevelDefault_Implementation() override;
+
+private:
+	/** Snap the panel, nav area and prompt to the current state (no animation). */
+	void ApplyStateImmediate();
 };
@@ -7,6 +7,8 @@
 #include "Interaction/SaveableInterface.h"
 #include "DrawerActor.generated.h"
 
+class UOpenableNavModifierComponent;
+
 /**
  * Sliding drawer/cabinet actor for The Juniper Tree.
  *
@@ -15,6 +17,10 @@
  * Toggles between open and closed states with smooth interpolation.
  *
  * Uses tick-based FInterpTo for smooth slide animation.
+ *
+ * Large drawers that block a walkway can set bAffectsNavigation; the open
+ * drawer is then marked as an obstacle through the budgeted nav update queue
+ * once the slide settles.
  */
 UCLASS()
 class PROJECTWALKINGSIM_API ADrawerActor : public AInteractableBase, public ISaveable
@@ -24,6 +30,7 @@ class PROJECTWALKINGSIM_API ADrawerActor : public AInteractableBase, public ISav
 public:
 	ADrawerActor();
 
+	virtual void OnConstruction(const FTransform& Transform) override;
 	virtual void BeginPlay() override;
 	virtual void Tick(float DeltaTime) override;
 
@@ -31,6 +38,7 @@ public:
 	virtual FName GetSaveId_Implementation() const override;
 	virtual void WriteSaveData_Implementation(USereneSaveGame* SaveGame) override;
 	virtual void ReadSaveData_Implementation(USereneSaveGame* SaveGame) override;
+	virtual void ResetToLevelDefault_Implementation() override;
 
 protected:
 	virtual void OnInteract_Implementation(AActor* Interactor) override;
@@ -47,7 +55,18 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Drawer")
 	float OpenSpeed = 4.0f;
 
+	/** If true, an open drawer marks its footprint as a nav obstacle. Enable for large drawers only. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Drawer|Navigation")
+	bool bAffectsNavigation = false;
+
+	/** Nav-area modifier driven by the open state. Inert unless bAffectsNavigation is set. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Drawer|Navigation")
+	TObjectPtr<UOpenableNavModifierComponent> NavModifier;
+
 private:
+	/** Snap the mesh, nav area and prompt to the current state (no animation). */
+	void ApplyStateImmediate();
+
 	/** Whether the drawer is currently open. */
 	bool bIsOpen = false;
 
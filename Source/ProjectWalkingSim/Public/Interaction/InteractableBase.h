@@ -23,6 +23,10 @@
  *
  * Tick is disabled by default. Subclasses that need animation (door, drawer)
  * opt in by setting PrimaryActorTick.bCanEverTick = true in their constructors.
+ *
+ * Subclasses implementing ISaveable are registered with
+ * USaveableRegistrySubsystem for their lifetime (BeginPlay to EndPlay), and
+ * call MarkSaveDirty whenever their saved state changes.
  */
 UCLASS(Abstract)
 class PROJECTWALKINGSIM_API AInteractableBase : public AActor, public IInteractable
@@ -41,6 +45,12 @@ public:
 	virtual void OnFocusEnd_Implementation(AActor* Interactor) override;
 
 protected:
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	/** Journal a change to this saveable's state so the next save re-writes it. */
+	void MarkSaveDirty();
+
 	/** Text displayed in the interaction prompt (e.g., "Open", "Pick Up", "Read"). */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Interaction")
 	FText InteractionText;
@@ -18,6 +18,15 @@ class UItemDataAsset;
  *
  * Designers set ItemId and Quantity per instance. The mesh represents the
  * physical item in the world.
+ *
+ * Level-placed pickups are parked (hidden, no collision, not interactable)
+ * instead of destroyed when picked up, so an in-place restore can bring them
+ * back from the parked instance without respawning. Pickups spawned at runtime
+ * (discarded items) are destroyed as before.
+ *
+ * Resting level-placed pickups are drawn by UPickupInstancingSubsystem until
+ * the player comes near (see there). Pickups with material overrides on their
+ * mesh or that simulate physics keep drawing themselves.
  */
 UCLASS()
 class PROJECTWALKINGSIM_API APickupActor : public AInteractableBase, public ISaveable
@@ -36,8 +45,15 @@ public:
 	 */
 	void InitFromItemData(FName InItemId, int32 InQuantity, const UItemDataAsset* ItemData);
 
+	/** Whether this level-placed pickup has been picked up and is parked. */
+	bool IsPickedUp() const { return bPickedUp; }
+
+	/** Mesh drawn while this pickup is its own actor (hidden while instanced). */
+	UStaticMeshComponent* GetPickupMesh() const { return MeshComponent; }
+
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void OnInteract_Implementation(AActor* Interactor) override;
 	virtual bool CanInteract_Implementation(AActor* Interactor) const override;
 	virtual FText GetInteractionText_Implementation() const override;
@@ -58,8 +74,20 @@ protected:
 	virtual FName GetSaveId_Implementation() const override;
 	virtual void WriteSaveData_Implementation(USereneSaveGame* SaveGame) override;
 	virtual void ReadSaveData_Implementation(USereneSaveGame* SaveGame) override;
+	virtual void ResetToLevelDefault_Implementation() override;
 
 private:
+	/** Level-placed pickups are parked on pickup, runtime-spawned ones destroyed. */
+	bool IsLevelPlaced() const { return HasAnyFlags(RF_WasLoaded); }
+
+	/** Park (hide, disable collision and interaction) or un-park this pickup. */
+	void SetPickedUp(bool bNewPickedUp);
+
+	/** Level-placed, static and using the mesh's own materials: can be drawn as an instance. */
+	bool CanBeInstanced() const;
+
+	bool bPickedUp = false;
+
 	/** Cached state from CanInteract for GetInteractionText. Mutable because CanInteract is const. */
 	mutable bool bInventoryFullOnLastCheck = false;
 };
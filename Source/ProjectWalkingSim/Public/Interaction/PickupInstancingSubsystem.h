@@ -0,0 +1,131 @@
+// Copyright Null Lantern.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "PickupInstancingSubsystem.generated.h"
+
+class APickupActor;
+class UInstancedStaticMeshComponent;
+class UStaticMesh;
+
+/**
+ * Draws resting level-placed pickups through one instanced static mesh per
+ * mesh, and hands a pickup back to its own actor only while the player is
+ * near it.
+ *
+ * Pickups register in BeginPlay (APickupActor decides eligibility: placed in
+ * the level, not simulating physics, no material overrides). A registered
+ * pickup is "demoted": its mesh component is hidden and has no collision, and
+ * an instance at the same transform is drawn instead. Within
+ * Serene.Pickups.PromoteRadius of the player it is "promoted" -- instance
+ * hidden, mesh and collision back -- so the interaction trace hits a real
+ * actor; it is demoted again past 1.25x that radius.
+ *
+ * Draw calls scale with the number of distinct pickup meshes, not pickups,
+ * and only pickups around the player carry collision. The actors themselves
+ * remain (they own the save id, interaction and parked state); parked
+ * pickups (IsPickedUp) draw no instance.
+ *
+ * Promotion checks run every PromoteCheckInterval and visit only the grid
+ * cells around the player. Serene.Pickups.Instanced 0 leaves pickups
+ * registering from then on as ordinary actors.
+ */
+UCLASS()
+class PROJECTWALKINGSIM_API UPickupInstancingSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	/** Draw Pickup as an instance until the player comes near. Called from APickupActor::BeginPlay. */
+	void RegisterPickup(APickupActor* Pickup);
+
+	/** Return Pickup to ordinary actor rendering. Called from APickupActor::EndPlay. */
+	void UnregisterPickup(APickupActor* Pickup);
+
+	/** Re-evaluate Pickup's instance after it is parked or un-parked. */
+	void RefreshPickup(const APickupActor* Pickup);
+
+	/** Number of registered pickups. */
+	int32 GetNumPickups() const { return PickupToEntry.Num(); }
+
+	/** Number of registered pickups currently drawn by their own actor. */
+	int32 GetNumPromoted() const { return PromotedEntries.Num(); }
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	struct FPickupEntry
+	{
+		TWeakObjectPtr<APickupActor> Pickup;
+		FVector Location = FVector::ZeroVector;
+		FTransform MeshTransform;
+		int32 BatchIndex = INDEX_NONE;
+		int32 InstanceIndex = INDEX_NONE;
+
+		/** Collision of the pickup's mesh before it was demoted. */
+		ECollisionEnabled::Type MeshCollision = ECollisionEnabled::NoCollision;
+
+		bool bPromoted = false;
+	};
+
+	/** One instanced mesh component per distinct pickup mesh. */
+	struct FMeshBatch
+	{
+		TWeakObjectPtr<UStaticMesh> Mesh;
+
+		/** Instances of unregistered pickups, hidden and reused by the next registration. */
+		TArray<int32> FreeInstances;
+	};
+
+	FIntPoint GetCell(const FVector& Location) const;
+
+	/** Batch drawing Mesh, created on first use. */
+	int32 FindOrAddBatch(UStaticMesh* Mesh, const APickupActor* Pickup);
+
+	/** Show or hide an entry's instance (hidden = zero scale, so instance indices stay stable). */
+	void UpdateInstance(const FPickupEntry& Entry);
+
+	void Promote(int32 EntryIndex);
+	void Demote(int32 EntryIndex);
+
+	/** Pickup entries; unregistered pickups leave a slot that is reused on the next register. */
+	TArray<FPickupEntry> Entries;
+
+	TArray<int32> FreeEntries;
+
+	TMap<TWeakObjectPtr<const APickupActor>, int32> PickupToEntry;
+
+	/** Grid cell -> entry indices. */
+	TMap<FIntPoint, TArray<int32>> Grid;
+
+	/** Entries currently promoted (checked for demotion each update). */
+	TArray<int32> PromotedEntries;
+
+	TArray<FMeshBatch> Batches;
+
+	/** Instanced mesh per batch, same order as Batches. */
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UInstancedStaticMeshComponent>> BatchComponents;
+
+	/** Transient actor owning BatchComponents, spawned with the first batch. */
+	UPROPERTY(Transient)
+	TObjectPtr<AActor> BatchOwner;
+
+	float TimeSinceCheck = 0.0f;
+
+	/** Grid cell edge in cm. */
+	static constexpr float CellSize = 1000.0f;
+
+	/** Seconds between promotion checks. */
+	static constexpr float PromoteCheckInterval = 0.1f;
+
+	/** Demotion distance as a multiple of the promote radius (hysteresis). */
+	static constexpr float DemoteRadiusScale = 1.25f;
+};
@@ -18,9 +18,15 @@ class USaveable : public UInterface
  * Contract for actors that persist state across save/load cycles.
  *
  * Actors implementing this interface write their state into and read
- * it back from USereneSaveGame. The save subsystem calls WriteSaveData
- * during save and ReadSaveData during load for every ISaveable actor
- * found in the world.
+ * it back from USereneSaveGame. WriteSaveData is called only after the
+ * actor journals a change with USaveableRegistrySubsystem::MarkDirty (see
+ * AInteractableBase::MarkSaveDirty); unchanged actors are not revisited.
+ * ReadSaveData is called on every registered actor; actors not present
+ * in the save keep their level state.
+ *
+ * For an in-place restore (no level reload) every saveable is first put
+ * back into its level state with ResetToLevelDefault, then ReadSaveData
+ * applies the snapshot on top.
  */
 class PROJECTWALKINGSIM_API ISaveable
 {
@@ -38,4 +44,8 @@ public:
 	/** Restore this actor's state from saved data. */
 	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category = "Save")
 	void ReadSaveData(USereneSaveGame* SaveGame);
+
+	/** Return to the state this actor had when the level started (as after a fresh level load). */
+	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category = "Save")
+	void ResetToLevelDefault();
 };
@@ -0,0 +1,47 @@
+// Copyright Null Lantern.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "CombineRecipeDataAsset.generated.h"
+
+/** One combination: the ingredients consumed (one of each entry) and what they make. */
+USTRUCT(BlueprintType)
+struct PROJECTWALKINGSIM_API FCombineRecipe
+{
+	GENERATED_BODY()
+
+	/** Distinct ItemIds consumed, one unit each (one inventory slot per ingredient). Order does not matter. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Recipe")
+	TArray<FName> Ingredients;
+
+	/** ItemId added to the inventory. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Recipe")
+	FName ResultItemId;
+
+	/** Quantity of ResultItemId added. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Recipe", meta = (ClampMin = "1"))
+	int32 ResultQuantity = 1;
+};
+
+/**
+ * A set of item combine recipes, authored under Content/Data/Recipes/.
+ *
+ * Discovered by the Asset Manager as the "CombineRecipes" primary asset type
+ * and loaded with the items by UItemRegistrySubsystem, which merges every
+ * recipe asset into one FCombineRecipeTable shared by all inventories.
+ * Splitting recipes across several assets (e.g. per chapter) is fine.
+ */
+UCLASS(BlueprintType)
+class PROJECTWALKINGSIM_API UCombineRecipeDataAsset : public UPrimaryDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	/** Returns a unique identifier for Asset Manager registration. */
+	virtual FPrimaryAssetId GetPrimaryAssetId() const override;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Recipe")
+	TArray<FCombineRecipe> Recipes;
+};
@@ -0,0 +1,57 @@
+// Copyright Null Lantern.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Inventory/CombineRecipeDataAsset.h"
+
+/**
+ * Combine recipes keyed by their ingredient multiset.
+ *
+ * Each recipe's ingredients are sorted into a canonical key when it is added,
+ * so lookups are one hash probe regardless of ingredient order or recipe
+ * count. Plain data: built once by UItemRegistrySubsystem and shared.
+ */
+class PROJECTWALKINGSIM_API FCombineRecipeTable
+{
+public:
+	/**
+	 * Add Recipe. Recipes with fewer than two ingredients, a repeated ingredient, no
+	 * result, or the same ingredients as an earlier recipe are rejected with a warning.
+	 * @param SourceName Asset the recipe came from (for the warning).
+	 */
+	bool Add(const FCombineRecipe& Recipe, const FString& SourceName);
+
+	/** Recipe consuming exactly Ingredients (any order), or nullptr. */
+	const FCombineRecipe* Find(TConstArrayView<FName> Ingredients) const;
+
+	void Reset();
+
+	int32 Num() const { return Recipes.Num(); }
+
+private:
+	/** Ingredients in FName index order. */
+	struct FRecipeKey
+	{
+		TArray<FName, TInlineAllocator<4>> Ingredients;
+
+		explicit FRecipeKey(TConstArrayView<FName> InIngredients);
+
+		bool operator==(const FRecipeKey& Other) const { return Ingredients == Other.Ingredients; }
+
+		friend uint32 GetTypeHash(const FRecipeKey& Key)
+		{
+			uint32 Hash = 0;
+			for (const FName& Ingredient : Key.Ingredients)
+			{
+				Hash = HashCombineFast(Hash, GetTypeHash(Ingredient));
+			}
+			return Hash;
+		}
+	};
+
+	TArray<FCombineRecipe> Recipes;
+
+	/** Key -> index into Recipes. */
+	TMap<FRecipeKey, int32> RecipeIndices;
+};
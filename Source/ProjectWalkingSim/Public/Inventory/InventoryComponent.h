@@ -14,13 +14,12 @@ class APickupActor;
  * Inventory component managing an 8-slot item system for The Juniper Tree.
  *
  * Attach to ASereneCharacter to provide item storage. The component maintains
- * an array of FInventorySlot structs and a registry mapping ItemId (FName) to
- * UItemDataAsset instances for metadata lookup.
+ * an array of FInventorySlot structs; item metadata is looked up by ItemId in
+ * the game instance's UItemRegistrySubsystem (loaded once, asynchronously).
  *
- * On BeginPlay, the component scans the Asset Manager for all "Item" type
- * primary assets and caches them in ItemRegistry for O(1) lookup by ItemId.
- *
- * All slot modifications broadcast OnInventoryChanged for UI updates.
+ * Every slot modification broadcasts OnInventorySlotsChanged with just the
+ * slots that operation touched (UI updates only those), then the coarse
+ * OnInventoryChanged for listeners that re-read everything.
  * Failed operations (e.g., inventory full) broadcast OnInventoryActionFailed.
  *
  * Key operations:
@@ -28,6 +27,7 @@ class APickupActor;
  * - RemoveItem: Remove quantity from specific slot
  * - DiscardItem: Spawn item into world and remove from inventory
  * - GetItemData: Lookup item definition by ItemId
+ * - TryCombineItems / TryCombineSlots: Combine via the shared recipe table
  */
 UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
 class PROJECTWALKINGSIM_API UInventoryComponent : public UActorComponent
@@ -37,8 +37,6 @@ class PROJECTWALKINGSIM_API UInventoryComponent : public UActorComponent
 public:
 	UInventoryComponent();
 
-	virtual void BeginPlay() override;
-
 	/** Maximum number of inventory slots. */
 	static constexpr int32 MaxSlots = 8;
 
@@ -105,7 +103,7 @@ public:
 	const TArray<FInventorySlot>& GetSlots() const { return Slots; }
 
 	/**
-	 * Lookup item definition by ItemId.
+	 * Lookup item definition by ItemId (UItemRegistrySubsystem::FindItem).
 	 * @param ItemId Identifier to lookup
 	 * @return Pointer to item data asset, nullptr if not registered
 	 */
@@ -139,14 +137,24 @@ public:
 	 * Attempt to combine items from two slots.
 	 * @param SlotIndexA First item slot
 	 * @param SlotIndexB Second item slot
-	 * @return true if combination succeeded, false if no recipe exists
+	 * @return true if combination succeeded (see TryCombineSlots)
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Inventory")
 	bool TryCombineItems(int32 SlotIndexA, int32 SlotIndexB);
 
+	/**
+	 * Attempt to combine one unit from each of several slots (any order), using the
+	 * shared recipe table in UItemRegistrySubsystem.
+	 * @param SlotIndices Distinct, occupied slots
+	 * @return true if combination succeeded; false if no recipe exists or the result does not fit
+	 *         (the ingredients are then left in place)
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Inventory")
+	bool TryCombineSlots(const TArray<int32>& SlotIndices);
+
 	/**
 	 * Restore inventory from saved data. Replaces all current slots.
-	 * Broadcasts OnInventoryChanged after restoration.
+	 * Broadcasts the slots that differ from before, then OnInventoryChanged.
 	 * @param SavedSlots Array of saved inventory slots to restore
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Inventory")
@@ -158,6 +166,10 @@ public:
 	UPROPERTY(BlueprintAssignable, Category = "Inventory")
 	FOnInventoryChanged OnInventoryChanged;
 
+	/** Broadcast before OnInventoryChanged with the slots an operation changed and how. */
+	UPROPERTY(BlueprintAssignable, Category = "Inventory")
+	FOnInventorySlotsChanged OnInventorySlotsChanged;
+
 	/** Broadcast when an inventory action fails (e.g., inventory full). */
 	UPROPERTY(BlueprintAssignable, Category = "Inventory")
 	FOnInventoryActionFailed OnInventoryActionFailed;
@@ -171,17 +183,16 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Inventory")
 	TArray<FInventorySlot> Slots;
 
-	/** Registry mapping ItemId to item data asset. Populated from Asset Manager at BeginPlay. */
-	UPROPERTY()
-	TMap<FName, TObjectPtr<UItemDataAsset>> ItemRegistry;
-
 private:
-	/** Load all UItemDataAsset instances from Asset Manager. */
-	void LoadItemRegistry();
+	/**
+	 * Add Quantity of ItemId to existing stacks, then empty slots, without broadcasting.
+	 * @return Quantity that did not fit (0 on success)
+	 */
+	int32 FillSlots(FName ItemId, const UItemDataAsset& ItemData, int32 Quantity, TArray<FInventorySlotChange>& Changes);
 
-	/** Combine recipes: {ItemA, ItemB} -> ResultItem. Order-independent (both permutations checked). */
-	TMap<TPair<FName, FName>, FName> CombineRecipes;
+	/** Append SlotIndex to Changes if its contents differ from Before. */
+	void RecordSlotChange(TArray<FInventorySlotChange>& Changes, int32 SlotIndex, const FInventorySlot& Before) const;
 
-	/** Initialize combine recipes. Called in BeginPlay after registry load. */
-	void InitCombineRecipes();
+	/** Broadcast OnInventorySlotsChanged then OnInventoryChanged, if Changes is not empty. */
+	void BroadcastSlotChanges(const TArray<FInventorySlotChange>& Changes);
 };
@@ -39,9 +39,40 @@ struct PROJECTWALKINGSIM_API FInventorySlot
 	bool IsEmpty() const { return ItemId == NAME_None || Quantity <= 0; }
 };
 
+/** How a single inventory slot changed in one operation. */
+UENUM(BlueprintType)
+enum class EInventorySlotChange : uint8
+{
+	Added,     // Empty slot now holds an item
+	Removed,   // Slot is now empty
+	Quantity,  // Same item, different quantity
+	Replaced   // Different item (e.g., restored from a save)
+};
+
+/** One changed slot, as reported by FOnInventorySlotsChanged. */
+USTRUCT(BlueprintType)
+struct PROJECTWALKINGSIM_API FInventorySlotChange
+{
+	GENERATED_BODY()
+
+	FInventorySlotChange() = default;
+	FInventorySlotChange(int32 InSlotIndex, EInventorySlotChange InKind)
+		: SlotIndex(InSlotIndex), Kind(InKind) {}
+
+	/** Index into UInventoryComponent::GetSlots. */
+	UPROPERTY(BlueprintReadOnly, Category = "Inventory")
+	int32 SlotIndex = INDEX_NONE;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Inventory")
+	EInventorySlotChange Kind = EInventorySlotChange::Quantity;
+};
+
 /** Broadcast when any inventory slot changes (add, remove, modify). */
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnInventoryChanged);
 
+/** Broadcast once per inventory operation with only the slots it changed. */
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnInventorySlotsChanged, const TArray<FInventorySlotChange>&, Changes);
+
 /** Broadcast when an inventory action fails (e.g., inventory full). */
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnInventoryActionFailed, FName, ItemId, FText, Reason);
 
@@ -0,0 +1,76 @@
+// Copyright Null Lantern.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "Inventory/CombineRecipeTable.h"
+#include "ItemRegistrySubsystem.generated.h"
+
+class UItemDataAsset;
+struct FStreamableHandle;
+
+/**
+ * Every UItemDataAsset ("Item" primary asset type), keyed by ItemId, and
+ * every combine recipe ("CombineRecipes", UCombineRecipeDataAsset) merged
+ * into one FCombineRecipeTable.
+ *
+ * Loaded once per game instance: once the Asset Manager's initial scan has
+ * finished, all Item and CombineRecipes assets are requested with one async
+ * LoadPrimaryAssets call and kept loaded by the returned handle. Inventory components and
+ * pickups look items up here instead of scanning the asset list, so level
+ * start costs O(1) per pickup regardless of how many items exist.
+ *
+ * The load normally completes long before gameplay needs an item. Code that
+ * only needs an item for presentation (pickup interaction text) uses
+ * CallOrRegisterOnReady; FindItem called before the load has finished waits
+ * for it (logged as a warning) rather than failing. Before the Asset Manager's
+ * initial scan the load has not started and there is nothing to wait on:
+ * lookups then log a warning and find nothing.
+ */
+UCLASS()
+class PROJECTWALKINGSIM_API UItemRegistrySubsystem : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	/** Item data for ItemId, or nullptr if no Item asset has that id. Waits for the load if still running (nullptr with a warning before the asset scan). */
+	const UItemDataAsset* FindItem(FName ItemId);
+
+	/** Recipe consuming exactly Ingredients (any order), or nullptr. Waits like FindItem. */
+	const FCombineRecipe* FindRecipe(TConstArrayView<FName> Ingredients);
+
+	/** Whether the item load has finished. */
+	bool IsReady() const { return bReady; }
+
+	/** Run Delegate now if the registry is ready, otherwise once it is. */
+	void CallOrRegisterOnReady(FSimpleDelegate&& Delegate);
+
+	/** Number of registered items. */
+	int32 GetNumItems() const { return ItemsById.Num(); }
+
+private:
+	/** Request every Item primary asset. Runs once the Asset Manager has scanned. */
+	void StartLoad();
+
+	/** Build ItemsById and Recipes from the loaded assets and fire the ready callbacks. Idempotent. */
+	void OnItemsLoaded();
+
+	/** Block on the load if it has not finished (logged: callers should normally find it done); warns if it has not started. */
+	void WaitForLoad(const TCHAR* Reason);
+
+	UPROPERTY(Transient)
+	TMap<FName, TObjectPtr<UItemDataAsset>> ItemsById;
+
+	FCombineRecipeTable Recipes;
+
+	/** Keeps the item assets loaded for the lifetime of the game instance. */
+	TSharedPtr<FStreamableHandle> LoadHandle;
+
+	FSimpleMulticastDelegate OnReady;
+
+	bool bReady = false;
+};
@@ -15,6 +15,10 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnNarrativeTriggered);
  * When the player enters the trigger volume, plays an optional monologue sound
  * and broadcasts a delegate that other systems can listen to (e.g., spawn Wendigo).
  * Supports one-shot guard and configurable delay before firing.
+ *
+ * Also the checkpoint trigger: when it fires it captures a SaveSubsystem
+ * checkpoint first (bCreatesCheckpoint). A trigger with no monologue at a
+ * doorway is a room-transition checkpoint.
  */
 UCLASS()
 class PROJECTWALKINGSIM_API ANarrativeTriggerActor : public AActor
@@ -28,6 +32,9 @@ public:
 	UPROPERTY(BlueprintAssignable, Category = "Narrative")
 	FOnNarrativeTriggered OnNarrativeTriggered;
 
+	/** Arm the trigger again and cancel a pending delayed fire (level reset). */
+	void Rearm();
+
 protected:
 	/** Trigger volume for overlap detection. */
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Narrative")
@@ -49,8 +56,12 @@ protected:
 	UPROPERTY(EditAnywhere, Category = "Narrative", meta = (ClampMin = "0.0"))
 	float TriggerDelay = 0.0f;
 
+	/** Capture a checkpoint when the trigger fires, before OnNarrativeTriggered (so a retry replays the beat). */
+	UPROPERTY(EditAnywhere, Category = "Narrative")
+	bool bCreatesCheckpoint = true;
+
 private:
-	/** One-shot guard. Not UPROPERTY -- resets on level reload (transient runtime state). */
+	/** One-shot guard. Not UPROPERTY -- resets on level reload and in-place reset (transient runtime state). */
 	bool bHasTriggered = false;
 
 	/** Timer handle for delayed trigger. */
@@ -15,13 +15,14 @@ class USaveSubsystem;
  *
  * C++ base class with full logic; requires a UMG Blueprint subclass (WBP_GameOver) with:
  *   - "GameOverText"           (UTextBlock) -- "GAME OVER" title
- *   - "LoadLastSaveButton"     (UButton)    -- loads most recent save or restarts
- *   - "LoadLastSaveButtonText" (UTextBlock) -- dynamic text: "Load Last Save" / "Restart"
+ *   - "LoadLastSaveButton"     (UButton)    -- retries, loads most recent save or restarts
+ *   - "LoadLastSaveButtonText" (UTextBlock) -- dynamic text: "Retry" / "Load Last Save" / "Restart"
  *   - "QuitButton"             (UButton)    -- exits to desktop
  *
  * Behavior:
- *   - On construct, checks SaveSubsystem->HasAnySave() to decide button text.
- *   - Load button either loads latest save or restarts the current level.
+ *   - On construct, checks SaveSubsystem->HasCheckpoint() / HasAnySave() to decide button text.
+ *   - Load button retries from the latest in-memory checkpoint, else loads the
+ *     latest save, else restarts the current level.
  *   - Quit button exits the application.
  *
  * Usage:
@@ -41,11 +42,11 @@ protected:
 	UPROPERTY(meta = (BindWidget))
 	TObjectPtr<UTextBlock> GameOverText;
 
-	/** Button to load the most recent save or restart. Must exist in UMG Blueprint. */
+	/** Button to retry, load the most recent save or restart. Must exist in UMG Blueprint. */
 	UPROPERTY(meta = (BindWidget))
 	TObjectPtr<UButton> LoadLastSaveButton;
 
-	/** Text on the load button. Dynamically set to "Load Last Save" or "Restart". */
+	/** Text on the load button. Dynamically set to "Retry", "Load Last Save" or "Restart". */
 	UPROPERTY(meta = (BindWidget))
 	TObjectPtr<UTextBlock> LoadLastSaveButtonText;
 
@@ -54,7 +55,7 @@ protected:
 	TObjectPtr<UButton> QuitButton;
 
 private:
-	/** Handler for LoadLastSaveButton click. Loads latest save or restarts level. */
+	/** Handler for LoadLastSaveButton click. Retries from checkpoint, loads latest save or restarts level. */
 	UFUNCTION()
 	void HandleLoadClicked();
 
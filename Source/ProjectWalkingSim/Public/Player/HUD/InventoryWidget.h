@@ -5,13 +5,13 @@
 #include "CoreMinimal.h"
 #include "Blueprint/UserWidget.h"
 #include "Player/HUD/ItemTooltipWidget.h"
+#include "Inventory/InventoryTypes.h"
 #include "InventoryWidget.generated.h"
 
 class UHorizontalBox;
 class UInventorySlotWidget;
 class UItemTooltipWidget;
 class UInventoryComponent;
-struct FInventorySlot;
 
 /**
  * Root inventory panel widget containing slot grid and tooltip.
@@ -32,7 +32,8 @@ struct FInventorySlot;
  *   2. Add HorizontalBox named "SlotContainer"
  *   3. Add WBP_ItemTooltip child named "ItemTooltip"
  *   4. Set SlotWidgetClass to WBP_InventorySlot in Blueprint defaults
- *   5. SereneHUD binds InventoryComponent::OnInventoryChanged to RefreshSlots
+ *   5. SereneHUD binds InventoryComponent::OnInventorySlotsChanged to RefreshChangedSlots
+ *      (and calls RefreshSlots when the panel opens)
  */
 UCLASS()
 class PROJECTWALKINGSIM_API UInventoryWidget : public UUserWidget
@@ -48,6 +49,14 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Inventory")
 	void RefreshSlots(const TArray<FInventorySlot>& Slots, UInventoryComponent* InventoryComp);
 
+	/**
+	 * Refresh only the slot widgets an inventory operation changed.
+	 * @param Changes Slots reported by InventoryComponent::OnInventorySlotsChanged
+	 * @param InventoryComp Inventory component the changes came from
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Inventory")
+	void RefreshChangedSlots(const TArray<FInventorySlotChange>& Changes, UInventoryComponent* InventoryComp);
+
 	/** Show the inventory panel (set opacity to 1). */
 	UFUNCTION(BlueprintCallable, Category = "Inventory")
 	void ShowInventory();
@@ -154,6 +163,9 @@ private:
 	UPROPERTY()
 	TObjectPtr<UInventoryComponent> CachedInventoryComp;
 
+	/** Update one slot widget from SlotData (clears and deselects it if empty). */
+	void RefreshSlotWidget(int32 SlotIndex, const FInventorySlot& SlotData);
+
 	/** Internal handler for slot click events. */
 	UFUNCTION()
 	void HandleSlotClicked(int32 SlotIndex);
@@ -40,6 +40,9 @@ public:
 	UPROPERTY(BlueprintAssignable, Category = "Pause")
 	FOnPauseMenuClosed OnPauseMenuClosed;
 
+	/** Remove the load menu if it is open (the pause menu itself stays). */
+	void CloseLoadMenu();
+
 protected:
 	virtual void NativeConstruct() override;
 
@@ -71,6 +71,7 @@ public:
 
 protected:
 	virtual void NativeConstruct() override;
+	virtual void NativeDestruct() override;
 
 	/** Menu title: "Save Game" or "Load Game". Must exist in UMG Blueprint. */
 	UPROPERTY(meta = (BindWidget))
@@ -138,6 +139,11 @@ private:
 	/** Refresh all 3 slot widgets from SaveSubsystem data. */
 	void RefreshSlots();
 
+	/** USaveSubsystem::OnSlotLoadFailed handler: the menu stays open and says so in the title. */
+	void HandleSlotLoadFailed(int32 SlotIndex);
+
+	FDelegateHandle LoadFailedHandle;
+
 	/** Helper: returns all slot widgets for iteration. */
 	TArray<USaveSlotWidget*> GetSlotWidgets() const;
 };
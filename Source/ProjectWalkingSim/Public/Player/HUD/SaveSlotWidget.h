@@ -9,6 +9,7 @@
 class UButton;
 class UImage;
 class UTextBlock;
+class UTexture2D;
 struct FSaveSlotInfo;
 
 /** Delegate broadcast when a save slot widget is clicked. */
@@ -18,7 +19,7 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnSaveSlotClicked, int32, SlotIndex
  * Displays a single save slot: screenshot thumbnail, timestamp, and empty/occupied indicator.
  *
  * C++ base class for a UMG Blueprint subclass (WBP_SaveSlot) with:
- *   - "ThumbnailImage" (UImage)     -- screenshot or placeholder
+ *   - "ThumbnailImage" (UImage)     -- screenshot, or PlaceholderThumbnail while it decodes
  *   - "TimestampText"  (UTextBlock) -- formatted date or "Empty"
  *   - "SlotLabelText"  (UTextBlock) -- "Slot 1", "Slot 2", "Slot 3"
  *   - "SlotButton"     (UButton)    -- clickable area
@@ -37,7 +38,8 @@ public:
 	/**
 	 * Populate the widget with slot data.
 	 * @param InSlotIndex Slot index (0-2)
-	 * @param Info Slot metadata (timestamp + screenshot bytes)
+	 * @param Info Slot metadata (timestamp). The thumbnail comes from USaveSubsystem's
+	 *             cache: the placeholder shows until it has been decoded.
 	 * @param bIsOccupied True if this slot has a save file
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Save")
@@ -53,6 +55,11 @@ public:
 
 protected:
 	virtual void NativeConstruct() override;
+	virtual void NativeDestruct() override;
+
+	/** Shown for empty slots and while an occupied slot's thumbnail is decoding. Optional. */
+	UPROPERTY(EditDefaultsOnly, Category = "Save")
+	TObjectPtr<UTexture2D> PlaceholderThumbnail;
 
 	/** Screenshot thumbnail or placeholder. Must exist in UMG Blueprint. */
 	UPROPERTY(meta = (BindWidget))
@@ -74,6 +81,17 @@ private:
 	/** Cached slot index set by SetSlotData. */
 	int32 SlotIndex = -1;
 
+	/** Whether SetSlotData was given an occupied slot (its thumbnail may still arrive). */
+	bool bOccupied = false;
+
+	/** Show Texture, or the placeholder if null. */
+	void SetThumbnail(UTexture2D* Texture);
+
+	/** USaveSubsystem::OnSlotThumbnailReady handler. */
+	void HandleThumbnailReady(int32 ReadySlotIndex, UTexture2D* Texture);
+
+	FDelegateHandle ThumbnailReadyHandle;
+
 	/** Internal handler for SlotButton click. Broadcasts OnSlotClicked. */
 	UFUNCTION()
 	void HandleSlotButtonClicked();
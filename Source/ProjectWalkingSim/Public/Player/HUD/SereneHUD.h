@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/HUD.h"
+#include "Inventory/InventoryTypes.h"
 #include "SereneHUD.generated.h"
 
 class USereneHUDWidget;
@@ -58,9 +59,12 @@ private:
 	UFUNCTION()
 	void HandleInteractableChanged(AActor* NewInteractable, FText InteractionText);
 
-	/** Forwards inventory changes to the InventoryWidget for refresh. */
+	/** Forwards changed inventory slots to the InventoryWidget, which redraws only those. */
 	UFUNCTION()
-	void HandleInventoryChanged();
+	void HandleInventorySlotsChanged(const TArray<FInventorySlotChange>& Changes);
+
+	/** Redraw every InventoryWidget slot (when the panel opens). */
+	void RefreshInventoryWidget();
 
 	/** Handles tooltip Use action from InventoryWidget. */
 	UFUNCTION()
@@ -43,6 +43,9 @@ public:
 	/** Toggle the pause menu on/off. Can be called externally. */
 	void TogglePauseMenu();
 
+	/** Close the pause menu (and its load menu) and the inventory. Used by in-place level restores. */
+	void CloseMenusForRestore();
+
 	/** Set whether a document/inspection overlay is currently open. Called by DocumentReaderWidget. */
 	void SetDocumentOpen(bool bOpen);
 
@@ -0,0 +1,77 @@
+// Copyright Null Lantern.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Inventory/InventoryTypes.h"
+#include "LevelResetSubsystem.generated.h"
+
+class AWendigoCharacter;
+class APatrolRouteActor;
+
+/**
+ * Puts the running level back into the state it had at BeginPlay without
+ * reloading the map, so death retries and same-map loads skip OpenLevel.
+ *
+ * Captured once when the world has begun play: every Wendigo's transform,
+ * patrol route and dormancy, plus the player's transform and inventory.
+ *
+ * ResetToLevelStart:
+ *  1. ISaveable::ResetToLevelDefault on every registered saveable (doors,
+ *     drawers, pickups -- parked pickups come back, discarded ones go away)
+ *  2. Wendigos: State Tree stopped and restarted through a dormant
+ *     round-trip, suspicion and memory cleared, start transform and route
+ *     restored; Wendigos acquired from the pool since are released to it
+ *  3. Narrative triggers re-armed, as a level reload would
+ *  4. Player: out of hiding, sprint/crouch stopped, teleported to the start
+ *     transform, inventory restored, Game Over / pause UI closed
+ *
+ * USaveSubsystem applies save data on top for an in-place load or a
+ * checkpoint retry.
+ */
+UCLASS()
+class PROJECTWALKINGSIM_API ULevelResetSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	/** Whether the level-start state has been captured (false until the world begins play). */
+	bool CanResetInPlace() const { return bCapturedLevelStart; }
+
+	/** Reset saveables, AI and the player to the level-start state. See class comment. */
+	void ResetToLevelStart();
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	/** Bound to UWorld::OnWorldBeginPlay, after every actor's BeginPlay. */
+	void CaptureLevelStart();
+
+	void ResetWendigos();
+	void ResetNarrativeTriggers();
+	void ResetPlayer();
+
+	struct FWendigoStart
+	{
+		TWeakObjectPtr<AWendigoCharacter> Wendigo;
+		FTransform Transform;
+		TWeakObjectPtr<APatrolRouteActor> PatrolRoute;
+		bool bDormant = false;
+	};
+
+	TArray<FWendigoStart> WendigoStarts;
+
+	bool bHasPlayerStart = false;
+	FTransform PlayerStartTransform;
+	FRotator PlayerStartControlRotation = FRotator::ZeroRotator;
+	TArray<FInventorySlot> PlayerStartInventory;
+
+	bool bCapturedLevelStart = false;
+
+	FDelegateHandle WorldBeginPlayHandle;
+};
@@ -0,0 +1,46 @@
+// Copyright Null Lantern.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UWorld;
+
+/**
+ * Save/load scaling benchmark (development builds only).
+ *
+ * For each count N, spawns a synthetic world of N doors, N drawers and N
+ * pickups below the current level (every other door/drawer changed from its
+ * default, every other pickup collected, full inventory) and times each stage
+ * of every save path:
+ *
+ *   Gather             registry fold with every saveable journalled (first save)
+ *   GatherIncremental  registry fold after a single door change
+ *   Serialize / Bytes  encode per format
+ *   Write              file write through FSaveFileFormat::WriteToSlot
+ *   Deserialize        FSaveFileFormat::Read (or checkpoint copy-out)
+ *   Apply              USaveableRegistrySubsystem::ReadAll of the decoded save
+ *
+ * Formats: Sectioned (FSaveFileFormat), Legacy (SaveVersion 1 tagged USaveGame)
+ * and Checkpoint (in-memory FSaveSnapshot, no file). RoundTrip checks the
+ * decoded record counts against the snapshot. Thumbnails are left out; their
+ * cost does not depend on world size.
+ *
+ * Results go to Saved/SaveBenchmark/SaveBenchmark_<Time>.csv, one row per
+ * count and format. Headless, e.g. for CI trend tracking:
+ *
+ *   UnrealEditor-Cmd ProjectWalkingSim.uproject /Game/Maps/DemoMap -game -nullrhi -nosound
+ *     -unattended -ExecCmds="Serene.Save.Benchmark 100 1000 10000, Quit"
+ *
+ * Synthetic actors are destroyed afterwards and every real saveable is
+ * re-journalled, so the session can keep going, but run it on a throwaway one.
+ */
+#if !UE_BUILD_SHIPPING
+
+namespace SereneSaveBenchmark
+{
+	/** Run the benchmark for each count in Counts, Iterations timed repeats per stage. @return CSV path. */
+	PROJECTWALKINGSIM_API FString Run(UWorld* World, const TArray<int32>& Counts, int32 Iterations);
+}
+
+#endif // !UE_BUILD_SHIPPING
@@ -0,0 +1,80 @@
+// Copyright Null Lantern.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class USereneSaveGame;
+struct FSaveSnapshot;
+
+/** Which parts of a save a reader decodes. The Meta section (slot info without the screenshot) is always read. */
+enum class ESaveReadParts : uint8
+{
+	None      = 0,
+	/** Thumbnail section into SlotInfo.ScreenshotData. */
+	Thumbnail = 1 << 0,
+	/** Names, Player and World sections: everything ApplySaveData restores. */
+	GameState = 1 << 1,
+	All       = Thumbnail | GameState
+};
+ENUM_CLASS_FLAGS(ESaveReadParts)
+
+/**
+ * On-disk encoding of a save (SaveVersion 2+): written from an FSaveSnapshot,
+ * read back into a USereneSaveGame.
+ *
+ * Layout (little-endian, written with FMemoryWriter):
+ *   Header         magic 'SRNS', SaveVersion, section count
+ *   Section table  per section: id, flags, offset, stored size, raw size
+ *   Sections       back to back, in table order:
+ *     Meta       slot timestamp, map, summary, screenshot size   (raw)
+ *     Thumbnail  JPEG bytes                                      (raw, already compressed)
+ *     Names      FName table: every id referenced by the sections below
+ *     Player     location, rotation, inventory (name index + quantity)
+ *     World      doors, drawers, destroyed pickups -- name index + packed state
+ *
+ * Names/Player/World are Oodle-compressed when that makes them smaller. Only
+ * doors and drawers that differ from their level defaults are present (the
+ * actors skip themselves in WriteSaveData), so a fresh save of a large level is
+ * a few hundred bytes plus the thumbnail.
+ *
+ * Readers skip sections they do not know, so new sections do not need a
+ * version bump. ReadFromSlot reads the header and table, then seeks to just
+ * the sections asked for: the save index rebuild reads Meta alone, the slot
+ * menu's thumbnail reads Meta + Thumbnail, and a load reads Meta +
+ * Names/Player/World and never touches the thumbnail.
+ *
+ * SaveVersion 1 files (UPROPERTY-tagged USaveGame) are detected by the
+ * missing magic and migrated on read.
+ */
+class PROJECTWALKINGSIM_API FSaveFileFormat
+{
+public:
+	/**
+	 * Encode Snapshot. Plain data only, safe on any thread.
+	 * @return false (OutBytes empty) if the snapshot has more distinct names than the uint16 name table holds.
+	 */
+	static bool Write(const FSaveSnapshot& Snapshot, TArray<uint8>& OutBytes);
+
+	/**
+	 * Write encoded bytes to a platform save slot. On desktop the file is written to a
+	 * temporary and renamed over the old save, so the slot is never left half-written.
+	 */
+	static bool WriteToSlot(const TArray<uint8>& Bytes, const FString& SlotName);
+
+	/**
+	 * Decode either format into a new transient USereneSaveGame.
+	 * Creates a UObject: worker-thread callers must hold FGCScopeGuard.
+	 * @param Parts  Sections to decode; SaveVersion 1 files are always read whole.
+	 * @return nullptr if the data is corrupt or not a save.
+	 */
+	static USereneSaveGame* Read(const TArray<uint8>& Bytes, ESaveReadParts Parts = ESaveReadParts::All);
+
+	/**
+	 * Read Parts of a platform save slot without loading the rest of the file. On desktop
+	 * only the header, table and requested sections are read from disk (large ones are
+	 * memory-mapped where supported); other platforms load the slot whole and decode Parts.
+	 * Same threading rules as Read. @return nullptr if missing, corrupt or not a save.
+	 */
+	static USereneSaveGame* ReadFromSlot(const FString& SlotName, ESaveReadParts Parts);
+};
@@ -0,0 +1,77 @@
+// Copyright Null Lantern.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Save/SaveTypes.h"
+
+class FArchive;
+
+/**
+ * Metadata for every save slot in one small file, so menus never deserialize
+ * full saves (which carry world state and the screenshot).
+ *
+ * Layout (little-endian, written with FMemoryWriter):
+ *   Header    magic, version, generation, slot count
+ *   Entries   occupied flag, timestamp, summary, screenshot size
+ *   CRC32     over everything above
+ *
+ * Thumbnails are not stored here: each stays in its save's Thumbnail section
+ * and is read on demand (USaveSubsystem::GetSlotThumbnail), so rewriting the
+ * index after a save or delete costs a few hundred bytes.
+ *
+ * Writes alternate between two platform save slots (SaveIndex_0/_1) with an
+ * increasing generation. Load picks the newest copy whose CRC checks out, so a
+ * crash or power loss mid-write leaves the previous index intact -- the update
+ * is atomic from the reader's point of view.
+ *
+ * Plain C++ (not a UObject): owned by USaveSubsystem.
+ */
+class PROJECTWALKINGSIM_API FSaveSlotIndex
+{
+public:
+	explicit FSaveSlotIndex(int32 InNumSlots);
+
+	/** Load the newest valid copy. @return False if none exists (caller should Rebuild). */
+	bool Load();
+
+	/** Write all entries to the older copy. */
+	bool Write();
+
+	/** Whether SlotIndex holds a save according to the index. */
+	bool IsOccupied(int32 SlotIndex) const;
+
+	/** Metadata for SlotIndex, or nullptr if the slot is empty/out of range. */
+	const FSaveSlotInfo* GetInfo(int32 SlotIndex) const;
+
+	/** Record a completed save (Info.ScreenshotData is not kept). Does not write -- call Write(). */
+	void SetEntry(int32 SlotIndex, const FSaveSlotInfo& Info);
+
+	/** Record a deleted slot. Does not write -- call Write(). */
+	void ClearEntry(int32 SlotIndex);
+
+	/** Slot with the newest timestamp, or -1. */
+	int32 GetLatestSlot() const;
+
+	bool HasAnyOccupied() const;
+
+	int32 GetNumSlots() const { return Entries.Num(); }
+
+private:
+	struct FEntry
+	{
+		bool bOccupied = false;
+		FSaveSlotInfo Info;
+	};
+
+	/** Serialize to/from bytes. Returns false on a malformed or foreign buffer. */
+	bool SerializeFromBytes(const TArray<uint8>& Bytes, uint32& OutGeneration);
+	void SerializeToBytes(TArray<uint8>& OutBytes) const;
+
+	static FString GetCopySlotName(int32 CopyIndex);
+
+	TArray<FEntry> Entries;
+
+	/** Generation of the last copy loaded or written. */
+	uint32 Generation = 0;
+};
@@ -0,0 +1,38 @@
+// Copyright Null Lantern.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Save/SaveTypes.h"
+#include "Inventory/InventoryTypes.h"
+
+class USereneSaveGame;
+
+/**
+ * Everything a save holds, as plain values (no UObject).
+ *
+ * USaveSubsystem captures one on the game thread in a single copy pass, then
+ * hands it to a worker for thumbnail encoding, FSaveFileFormat encoding and
+ * the file write. Checkpoints keep the same struct in memory. Field names
+ * mirror USereneSaveGame, which stays the load-side container that ISaveable
+ * actors read from.
+ */
+struct PROJECTWALKINGSIM_API FSaveSnapshot
+{
+	/** Timestamp, map and summary; the worker adds the thumbnail. */
+	FSaveSlotInfo SlotInfo;
+
+	FVector PlayerLocation = FVector::ZeroVector;
+	FRotator PlayerRotation = FRotator::ZeroRotator;
+	TArray<FInventorySlot> InventorySlots;
+
+	TArray<FSavedDoorState> DoorStates;
+	TArray<FSavedDrawerState> DrawerStates;
+	TArray<FName> DestroyedPickupIds;
+
+	/** Copy a loaded save's state (keeps this snapshot's array allocations). */
+	void CopyFrom(const USereneSaveGame& SaveGame);
+
+	/** Copy this state into SaveGame, e.g. to restore through ISaveable::ReadSaveData. */
+	void CopyTo(USereneSaveGame& SaveGame) const;
+};
@@ -5,9 +5,19 @@
 #include "CoreMinimal.h"
 #include "Subsystems/GameInstanceSubsystem.h"
 #include "Save/SaveTypes.h"
+#include "Save/SaveSlotIndex.h"
+#include "Save/SaveSnapshot.h"
 #include "SaveSubsystem.generated.h"
 
 class USereneSaveGame;
+class UTexture2D;
+struct FImage;
+
+/** Broadcast when a slot's thumbnail texture has been decoded and created. */
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnSlotThumbnailReady, int32 /*SlotIndex*/, UTexture2D* /*Texture*/);
+
+/** Broadcast when LoadFromSlot could not read or decode the save; the current level was left untouched. */
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnSlotLoadFailed, int32 /*SlotIndex*/);
 
 /**
  * Game instance subsystem that owns save/load orchestration for The Juniper Tree.
@@ -17,15 +27,44 @@ class USereneSaveGame;
  * - Load from slot via level restart + pending data application
  * - Quick-load latest save
  * - Runtime tracking of destroyed level-placed pickups
+ * - Slot metadata queries (HasAnySave, GetSlotInfo, ...) answered from the
+ *   in-memory save slot index -- no save file is read for menus
  *
  * Save flow:
- *  1. SaveToSlot -> request screenshot (async, end-of-frame)
- *  2. OnScreenshotCaptured -> compress JPEG, gather world state, async write to disk
+ *  1. SaveToSlot -> capture an FSaveSnapshot (plain value copies, no UObject),
+ *     request screenshot (async, end-of-frame)
+ *  2. OnScreenshotCaptured -> move the snapshot and bitmap to a worker, which
+ *     downscales the bitmap to a thumbnail, JPEG-encodes it, encodes the save and
+ *     writes it to disk (temp file + rename)
+ *  3. On write success (game thread) -> update + write the slot index
+ * Only one save runs at a time; SaveToSlot is ignored until step 3 is back on
+ * the game thread.
+ *
+ * Load flow (the game keeps running while the save is read):
+ *  1. LoadFromSlot -> read + deserialize the save on a worker thread
+ *  2. Worker finishes (game thread) -> on failure OnSlotLoadFailed fires and
+ *     nothing else changes; on success PendingSaveData is set, the checkpoint
+ *     ring is cleared and the level is reopened
+ *  3. GameMode's OnActorsReady calls ApplyPendingSaveDataWhenReady
+ *  4. Doors restored, pickups destroyed, player repositioned, inventory repopulated
+ *
+ * Saves made on the current map load in place instead: no OpenLevel, and
+ * ULevelResetSubsystem resets the running level to its start state before
+ * step 4 as soon as the worker finishes. RestartLevel (death retry without a
+ * save) does the reset alone.
+ *
+ * Checkpoints: a small in-memory ring of world + player snapshots, captured
+ * when a narrative trigger fires, on a timer (Serene.Save.CheckpointInterval)
+ * while no Wendigo is chasing, and whenever a save is written or loaded.
+ * RetryFromCheckpoint restores the latest one in place -- no disk I/O, no
+ * screenshot, no level load -- so death retries are near-instant.
  *
- * Load flow:
- *  1. LoadFromSlot -> store PendingSaveData, OpenLevel (full world reset)
- *  2. GameMode calls ApplyPendingSaveData after actors exist
- *  3. Doors restored, pickups destroyed, player repositioned, inventory repopulated
+ * Thumbnails: GetSlotThumbnail hands out a cached transient texture per slot,
+ * keyed by the save's timestamp. The JPEG is not in the slot index; a miss
+ * reads the save's Thumbnail section and decodes it on a worker, then creates
+ * the texture on the game thread when it finishes (OnSlotThumbnailReady), so
+ * menus open immediately with placeholders. Saving over or deleting a slot
+ * drops its entry.
  */
 UCLASS()
 class PROJECTWALKINGSIM_API USaveSubsystem : public UGameInstanceSubsystem
@@ -43,19 +82,33 @@ public:
 
 	/**
 	 * Save the current game state to a slot.
-	 * Captures a viewport screenshot (async), gathers world + player state,
-	 * then writes via AsyncSaveGameToSlot.
+	 * Captures world + player state into a plain snapshot and requests a viewport
+	 * screenshot; encoding with FSaveFileFormat and the write happen on a worker thread.
+	 * Ignored (with a warning) while another save is in progress -- see IsSaveInProgress.
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Save")
 	void SaveToSlot(int32 SlotIndex);
 
+	/** Whether a save is between SaveToSlot and its write finishing; SaveToSlot is ignored meanwhile. */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Save")
+	bool IsSaveInProgress() const { return InFlightSaveSlotIndex >= 0; }
+
 	/**
-	 * Load a saved game from slot. Stores save data as pending, then reloads the level.
-	 * After level reload, GameMode must call ApplyPendingSaveData().
+	 * Load a saved game from slot. Reads and validates the save on a worker, then reloads the
+	 * level; after the reload, GameMode must call ApplyPendingSaveDataWhenReady(). Saves of the
+	 * current map are restored in place without a reload. A save that cannot be read fires
+	 * OnSlotLoadFailed and leaves the running level (and its checkpoints) as they were.
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Save")
 	void LoadFromSlot(int32 SlotIndex);
 
+	/**
+	 * Put the current level back to its start state: in place when possible,
+	 * otherwise by reopening the map.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Save")
+	void RestartLevel();
+
 	/**
 	 * Find the most recent save across all slots and load it.
 	 * Does nothing if no saves exist.
@@ -68,13 +121,13 @@ public:
 	bool HasAnySave() const;
 
 	/**
-	 * Get metadata (timestamp + screenshot) for a specific slot.
-	 * Returns empty info if slot does not exist.
+	 * Get metadata (timestamp, summary, screenshot size) for a specific slot; ScreenshotData
+	 * is left empty -- use GetSlotThumbnail. Returns empty info if slot does not exist.
 	 */
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Save")
 	FSaveSlotInfo GetSlotInfo(int32 SlotIndex) const;
 
-	/** Delete a save slot entirely. */
+	/** Delete a save slot entirely. Ignored while that slot is being saved. */
 	UFUNCTION(BlueprintCallable, Category = "Save")
 	void DeleteSlot(int32 SlotIndex);
 
@@ -86,6 +139,41 @@ public:
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Save")
 	int32 GetLatestSlotIndex() const;
 
+	/**
+	 * Cached thumbnail texture for a slot. On a miss, starts decoding it in the background
+	 * and returns nullptr; OnSlotThumbnailReady fires when the texture exists. Also nullptr
+	 * for empty slots, saves without a screenshot and thumbnails that failed to decode.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Save")
+	UTexture2D* GetSlotThumbnail(int32 SlotIndex);
+
+	/** Fires on the game thread when a thumbnail requested through GetSlotThumbnail is ready. */
+	FOnSlotThumbnailReady OnSlotThumbnailReady;
+
+	/** Fires on the game thread when LoadFromSlot fails to read or decode a save. */
+	FOnSlotLoadFailed OnSlotLoadFailed;
+
+	// --- Checkpoints ---
+
+	/**
+	 * Snapshot world + player state into the checkpoint ring (overwrites the oldest).
+	 * Skipped while unsafe to resume from: Game Over, hiding, a Wendigo chasing or
+	 * grabbing, or a load in flight or being applied. Reason is only for logging.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Save")
+	void CaptureCheckpoint(FName Reason);
+
+	/** Whether RetryFromCheckpoint can restore a checkpoint of the current level. */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Save")
+	bool HasCheckpoint() const;
+
+	/** Restore the latest checkpoint in place. Returns false if there is none. */
+	UFUNCTION(BlueprintCallable, Category = "Save")
+	bool RetryFromCheckpoint();
+
+	/** Start the periodic checkpoint timer in World. Called by GameMode on BeginPlay. */
+	void StartCheckpointTimer(UWorld* World);
+
 	// --- State Management ---
 
 	/**
@@ -96,9 +184,15 @@ public:
 	 */
 	void ApplyPendingSaveData(UWorld* World);
 
-	/** Whether a load is pending (set before OpenLevel, read after). */
+	/**
+	 * Apply pending save data now if the background load has finished, otherwise
+	 * as soon as it does. Called by GameMode once all actors exist.
+	 */
+	void ApplyPendingSaveDataWhenReady(UWorld* World);
+
+	/** Whether a load is pending -- in flight or waiting to be applied (set before OpenLevel, read after). */
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Save")
-	bool IsPendingLoad() const { return PendingSaveData != nullptr; }
+	bool IsPendingLoad() const { return PendingLoadState != EPendingLoadState::None; }
 
 	/**
 	 * Get the pending save data for direct access (e.g., character restoring its own inventory).
@@ -132,29 +226,84 @@ private:
 	/** Generate the platform slot name for a given index. */
 	FString GetSlotName(int32 SlotIndex) const;
 
-	/** Gather world state (doors, drawers) into the save game object. */
-	void GatherWorldState(USereneSaveGame* SaveGame, UWorld* World);
+	/** One-time migration: build the index from existing save files (loads each once). */
+	void RebuildSaveIndex();
+
+	/**
+	 * Fill Snapshot with the current world + player state and slot summary (no thumbnail).
+	 * bUseSaveLocation: honour the tape recorder location override.
+	 */
+	void CaptureSnapshot(FSaveSnapshot& Snapshot, UWorld* World, bool bUseSaveLocation);
+
+	/** Gather world state (doors, drawers) into the snapshot. */
+	void GatherWorldState(FSaveSnapshot& Snapshot, UWorld* World);
+
+	/** Gather player state (location, rotation, inventory) into the snapshot. */
+	void GatherPlayerState(FSaveSnapshot& Snapshot, UWorld* World, bool bUseSaveLocation);
 
-	/** Gather player state (location, rotation, inventory) into the save game object. */
-	void GatherPlayerState(USereneSaveGame* SaveGame, UWorld* World);
+	/** Restore SaveGame into World; bResetFirst puts the running level back to its start state first. */
+	void ApplySaveData(UWorld* World, USereneSaveGame* SaveGame, bool bResetFirst);
+
+	// --- Checkpoints ---
+
+	/** Whether the current moment is safe to resume from (see CaptureCheckpoint). */
+	bool CanCaptureCheckpoint(UWorld* World) const;
+
+	/** Claim the next ring entry (overwriting the oldest); the caller fills the returned snapshot. nullptr once deinitialized. */
+	FSaveSnapshot* AddCheckpoint(FName Reason, float WorldTime);
+
+	/** Timer callback: capture unless a checkpoint was taken within the interval. */
+	void OnCheckpointTimer();
 
 	// --- Screenshot Capture ---
 
 	/** Callback for UGameViewportClient::OnScreenshotCaptured. */
 	void OnScreenshotCaptured(int32 Width, int32 Height, const TArray<FColor>& Bitmap);
 
+	/** Downscale to ThumbnailWidth and JPEG-encode into OutInfo. Runs on a worker thread. */
+	static void EncodeThumbnail(int32 Width, int32 Height, const TArray<FColor>& Bitmap, FSaveSlotInfo& OutInfo);
+
+	/** Width of the stored save thumbnail in pixels (height keeps the viewport aspect). */
+	static constexpr int32 ThumbnailWidth = 480;
+
 	/** Delegate handle for unbinding the screenshot callback. */
 	FDelegateHandle ScreenshotDelegateHandle;
 
-	/** Save object being constructed during a save flow (between screenshot request and write). */
-	UPROPERTY()
-	TObjectPtr<USereneSaveGame> PendingSaveObject;
+	/** State captured by SaveToSlot, handed to the worker when the screenshot arrives. */
+	FSaveSnapshot PendingSaveSnapshot;
 
-	/** Slot index for the in-progress save (used in screenshot callback). */
+	/** Slot index for the in-progress save (used in screenshot callback); -1 when none. */
 	int32 PendingSaveSlotIndex = -1;
 
+	/**
+	 * Slot being saved from SaveToSlot until the worker's result is back on the game thread; -1 when none.
+	 * Saves never overlap, so the slot temp file is never shared and index writes stay in save order.
+	 */
+	int32 InFlightSaveSlotIndex = -1;
+
 	// --- Pending Load Data ---
 
+	enum class EPendingLoadState : uint8
+	{
+		None,
+		Loading,  // Worker is reading/deserializing the save
+		Ready     // PendingSaveData set, waiting for the world
+	};
+
+	/** Game thread: the worker finished. Loaded is null on failure. */
+	void OnPendingLoadFinished(USereneSaveGame* Loaded, uint32 LoadSerial, int32 SlotIndex);
+
+	EPendingLoadState PendingLoadState = EPendingLoadState::None;
+
+	/** Identifies the in-flight load; results of superseded loads are dropped. */
+	uint32 PendingLoadSerial = 0;
+
+	/** World to restore into once the save is read (in-place loads only). */
+	TWeakObjectPtr<UWorld> PendingApplyWorld;
+
+	/** The pending load restores the current level in place instead of reloading it. */
+	bool bPendingLoadInPlace = false;
+
 	/** Save data to apply after level reload. Prevents GC via UPROPERTY. */
 	UPROPERTY()
 	TObjectPtr<USereneSaveGame> PendingSaveData;
@@ -162,6 +311,69 @@ private:
 	/** Runtime tracking of destroyed level-placed pickups. */
 	TSet<FName> DestroyedPickupTracker;
 
+	// --- Checkpoint Ring ---
+
+	/** Ring entry. Entries are reused, so snapshot arrays keep their allocations between captures. */
+	struct FCheckpoint
+	{
+		FName Reason;
+		float WorldTime = 0.0f;
+		FSaveSnapshot Snapshot;
+	};
+
+	/** Number of checkpoints kept; older ones are overwritten. */
+	static constexpr int32 MaxCheckpoints = 4;
+
+	/** Fixed-size ring, allocated in Initialize. */
+	TArray<FCheckpoint> Checkpoints;
+
+	/** Next entry to write. */
+	int32 CheckpointHead = 0;
+
+	/** Valid entries (at most MaxCheckpoints). */
+	int32 NumCheckpoints = 0;
+
+	/** Latest checkpoint, or nullptr if the ring is empty. */
+	const FCheckpoint* GetLatestCheckpoint() const;
+
+	/** Set while ApplySaveData runs. */
+	bool bApplyingSaveData = false;
+
+	/** Periodic checkpoint timer in the current world. */
+	FTimerHandle CheckpointTimerHandle;
+
+	// --- Thumbnail Cache ---
+
+	/** Drop a slot's cached thumbnail; any decode in flight for it is ignored when it finishes. */
+	void InvalidateThumbnail(int32 SlotIndex);
+
+	/** Game thread: a worker finished decoding. Image is null if the JPEG was corrupt. */
+	void OnThumbnailDecoded(int32 SlotIndex, uint32 DecodeSerial, const FImage* Image);
+
+	/** Per-slot cache key and decode bookkeeping (textures live in ThumbnailTextures). */
+	struct FThumbnailState
+	{
+		/** Timestamp of the save the entry was made for; default = no entry. */
+		FDateTime Timestamp;
+
+		/** Serial of the decode in flight, 0 if none. */
+		uint32 DecodeSerial = 0;
+	};
+
+	TArray<FThumbnailState> ThumbnailStates;
+
+	/** Decoded thumbnail per slot (null while decoding or if decoding failed). */
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UTexture2D>> ThumbnailTextures;
+
+	/** Last serial handed to a thumbnail decode. */
+	uint32 LastThumbnailSerial = 0;
+
+	// --- Slot Index ---
+
+	/** Timestamp and summary of every slot (no thumbnails). Loaded once in Initialize. */
+	FSaveSlotIndex SaveIndex = FSaveSlotIndex(MaxSlots);
+
 	// --- Pending Save Location ---
 
 	/** Override location for next save (e.g., tape recorder position). */
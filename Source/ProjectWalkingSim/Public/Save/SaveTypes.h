@@ -53,7 +53,9 @@ struct FSavedDrawerState
 
 /**
  * Metadata for a single save slot.
- * Displayed in the save/load UI: screenshot thumbnail + timestamp.
+ * Displayed in the save/load UI: screenshot thumbnail + timestamp + summary.
+ * Mirrored into the save slot index (FSaveSlotIndex) so menus never load full saves;
+ * the index leaves out ScreenshotData, which stays in the save file.
  */
 USTRUCT(BlueprintType)
 struct FSaveSlotInfo
@@ -75,4 +77,14 @@ struct FSaveSlotInfo
 	/** Height of the captured screenshot in pixels. */
 	UPROPERTY()
 	int32 ScreenshotHeight = 0;
+
+	// --- Summary ---
+
+	/** Map the save was made on. */
+	UPROPERTY()
+	FString MapName;
+
+	/** Number of occupied inventory slots at save time. */
+	UPROPERTY()
+	int32 InventoryItemCount = 0;
 };
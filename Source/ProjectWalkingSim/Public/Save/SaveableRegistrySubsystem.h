@@ -0,0 +1,95 @@
+// Copyright Null Lantern.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Save/SaveTypes.h"
+#include "SaveableRegistrySubsystem.generated.h"
+
+class USereneSaveGame;
+struct FSaveSnapshot;
+
+/**
+ * Every ISaveable actor in the world, keyed by ISaveable::GetSaveId.
+ *
+ * Actors register in BeginPlay and unregister in EndPlay (AInteractableBase
+ * does this for all its ISaveable subclasses; other saveables call
+ * RegisterSaveable themselves). USaveSubsystem gathers and restores through
+ * the registry, so save/load cost scales with the number of saveables rather
+ * than the number of actors in the world, and a new saveable type needs no
+ * save-subsystem changes.
+ *
+ * Mutation journal: saveables call MarkDirty when their saved state changes.
+ * WriteAll folds only the journalled saveables into a running snapshot of
+ * every record that differs from the level default, so a save costs
+ * O(changes since the last save), not O(saveables). The snapshot is reset by
+ * ResetAll and seeded by ReadAll, which keeps it matching the world after an
+ * in-place reset or a load. Serene.Save.FullGather 1 journals every saveable
+ * on each save (to check a saveable that forgets to MarkDirty).
+ */
+UCLASS()
+class PROJECTWALKINGSIM_API USaveableRegistrySubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+
+	/** Add an ISaveable actor under its save id. Duplicate ids are rejected with a warning. */
+	void RegisterSaveable(AActor* Saveable);
+
+	/** Remove an actor added with RegisterSaveable. */
+	void UnregisterSaveable(AActor* Saveable);
+
+	/** Actor registered under SaveId, or nullptr. */
+	AActor* FindSaveable(FName SaveId) const;
+
+	/** Journal a change to Saveable's saved state; it writes again on the next WriteAll. */
+	void MarkDirty(AActor* Saveable);
+
+	/** Journal every registered saveable (the next WriteAll re-writes them all). */
+	void MarkAllDirty();
+
+	/** Fold the journal into the snapshot, then append every changed door/drawer record to OutSnapshot. */
+	void WriteAll(FSaveSnapshot& OutSnapshot);
+
+	/** Call ReadSaveData on every registered saveable and seed the snapshot from SaveGame. Saveables may destroy themselves while reading. */
+	void ReadAll(USereneSaveGame* SaveGame);
+
+	/** Call ResetToLevelDefault on every registered saveable (in-place restore) and empty the snapshot. */
+	void ResetAll();
+
+	/** Number of registered saveables. */
+	int32 GetNumSaveables() const { return SaveIdToActor.Num(); }
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	/** Live registered actors, copied so callbacks may unregister (destroy) while iterating. */
+	TArray<AActor*> GetSaveablesSnapshot() const;
+
+	/** WriteSaveData on each journalled saveable; replace their snapshot records with the result. */
+	void FoldJournal();
+
+	TMap<FName, TWeakObjectPtr<AActor>> SaveIdToActor;
+
+	/** Id each actor registered under (GetSaveId may not be callable during EndPlay). */
+	TMap<TWeakObjectPtr<AActor>, FName> ActorToSaveId;
+
+	// --- Mutation Journal ---
+
+	/** Save ids changed since the last fold. */
+	TSet<FName> DirtySaveIds;
+
+	/** Changed-from-default door records as of the last fold, by save id. */
+	TMap<FName, FSavedDoorState> DoorSnapshot;
+
+	/** Changed-from-default drawer records as of the last fold, by save id. */
+	TMap<FName, FSavedDrawerState> DrawerSnapshot;
+
+	/** Reused target for journalled saveables' WriteSaveData. */
+	UPROPERTY()
+	TObjectPtr<USereneSaveGame> FoldScratch;
+};
@@ -11,8 +11,10 @@
 /**
  * Save game container for The Juniper Tree.
  *
- * Pure data class -- all fields are UPROPERTY() for automatic USaveGame
- * serialization via UGameplayStatics::SaveGameToSlot / LoadGameFromSlot.
+ * Pure data class: the load-side container that FSaveFileFormat decodes into
+ * and ISaveable actors read from. Saves are written from an FSaveSnapshot
+ * with the same fields. Fields stay UPROPERTY() so SaveVersion 1 files, which
+ * used USaveGame tagged serialization, can still be read and migrated.
  *
  * Uses flat struct arrays (not per-actor binary serialization) because the
  * project has a known, limited set of saveable state types and a single level.
@@ -27,9 +29,12 @@ public:
 
 	// --- Versioning ---
 
+	/** Version written by this build. 2 = FSaveFileFormat; 1 = USaveGame tagged properties. */
+	static constexpr int32 CurrentSaveVersion = 2;
+
 	/** Incremented on schema changes; enables future migration logic. */
 	UPROPERTY()
-	int32 SaveVersion = 1;
+	int32 SaveVersion = CurrentSaveVersion;
 
 	// --- Slot Metadata ---
 
@@ -62,4 +67,24 @@ public:
 	/** FNames of level-placed pickups that were picked up (destroyed). */
 	UPROPERTY()
 	TArray<FName> DestroyedPickupIds;
+
+	// --- Restore Lookups ---
+
+	/** Saved state of DoorId, or nullptr if it was not saved (still at its level default). */
+	const FSavedDoorState* FindDoorState(FName DoorId) const;
+
+	/** Saved state of DrawerId, or nullptr if it was not saved (still at its level default). */
+	const FSavedDrawerState* FindDrawerState(FName DrawerId) const;
+
+	/** Whether the pickup with PickupId was picked up. */
+	bool IsPickupDestroyed(FName PickupId) const;
+
+private:
+	/** Hash lookups over the arrays above, built on first query. The arrays must not change afterwards. */
+	void BuildLookups() const;
+
+	mutable TMap<FName, int32> DoorIndexById;
+	mutable TMap<FName, int32> DrawerIndexById;
+	mutable TSet<FName> DestroyedPickupSet;
+	mutable bool bLookupsBuilt = false;
 };